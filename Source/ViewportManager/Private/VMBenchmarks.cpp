@@ -0,0 +1,566 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "VMCompiledLayout.h"
+#include "VMSplitLayoutAsset.h"
+#include "VMCameraPawn.h"
+#include "VMGameViewportClient.h"
+#include "VMSplitSubsystem.h"
+#include "VMViewportManagerSettings.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/TargetPoint.h"
+#include "Engine/World.h"
+#include "InputCoreTypes.h"
+#include "InputKeyEventArgs.h"
+#include "VMLog.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace VMBenchmarks
+{
+	/** Builds a Columns x Rows grid of panes plus one picture-in-picture pane drawn on top. */
+	static UVMSplitLayoutAsset* CreateGridLayout(int32 NumPanes)
+	{
+		UVMSplitLayoutAsset* Layout = NewObject<UVMSplitLayoutAsset>();
+
+		const int32 GridPanes = FMath::Max(NumPanes - 1, 1);
+		const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(GridPanes)));
+		const int32 Rows = FMath::DivideAndRoundUp(GridPanes, Columns);
+
+		for (int32 i = 0; i < GridPanes; ++i)
+		{
+			FVMSplitPane Pane;
+			Pane.LocalPlayerIndex = i;
+			Pane.Rect.Origin01 = FVector2f(static_cast<float>(i % Columns) / Columns, static_cast<float>(i / Columns) / Rows);
+			Pane.Rect.Size01 = FVector2f(1.0f / Columns, 1.0f / Rows);
+			Pane.bReceivesKeyboardMouse = (i % 3) != 2;
+			Layout->Panes.Add(Pane);
+		}
+
+		if (NumPanes > 1)
+		{
+			FVMSplitPane PiP;
+			PiP.LocalPlayerIndex = GridPanes;
+			PiP.Rect.Origin01 = FVector2f(0.75f, 0.75f);
+			PiP.Rect.Size01 = FVector2f(0.25f, 0.25f);
+			Layout->Panes.Add(PiP);
+		}
+
+		return Layout;
+	}
+
+	/** Reference implementation of the pre-compiled routing path: map walk, then a linear pane scan for the flag. */
+	static int32 LegacyHitTest(const TMap<int32, FVMSplitRect>& PlayerRects, const UVMSplitLayoutAsset& Layout, const FVector2D& Position, bool& bOutReceivesInput)
+	{
+		for (const auto& Pair : PlayerRects)
+		{
+			const FVMSplitRect& Rect = Pair.Value;
+			if (Position.X >= Rect.Origin01.X && Position.X <= (Rect.Origin01.X + Rect.Size01.X) &&
+				Position.Y >= Rect.Origin01.Y && Position.Y <= (Rect.Origin01.Y + Rect.Size01.Y))
+			{
+				bOutReceivesInput = true;
+				for (const FVMSplitPane& Pane : Layout.Panes)
+				{
+					if (Pane.LocalPlayerIndex == Pair.Key)
+					{
+						bOutReceivesInput = Pane.bReceivesKeyboardMouse;
+						break;
+					}
+				}
+				return Pair.Key;
+			}
+		}
+
+		bOutReceivesInput = false;
+		return INDEX_NONE;
+	}
+
+	static void RunHitTestBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumPanes = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 64) : 16;
+		const int32 Iterations = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 1000000;
+
+		UVMSplitLayoutAsset* Layout = CreateGridLayout(NumPanes);
+
+		TMap<int32, FVMSplitRect> PlayerRects;
+		for (const FVMSplitPane& Pane : Layout->Panes)
+		{
+			PlayerRects.Add(Pane.LocalPlayerIndex, Pane.Rect);
+		}
+
+		FVMCompiledLayout Compiled;
+		Compiled.Compile(*Layout);
+
+		TArray<FVector2D> Samples;
+		Samples.SetNumUninitialized(4096);
+		FRandomStream Stream(0x564D);
+		for (FVector2D& Sample : Samples)
+		{
+			Sample = FVector2D(Stream.FRand(), Stream.FRand());
+		}
+
+		int64 LegacyChecksum = 0;
+		const double LegacyStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			bool bReceives = false;
+			LegacyChecksum += LegacyHitTest(PlayerRects, *Layout, Samples[i & 4095], bReceives) + (bReceives ? 1 : 0);
+		}
+		const double LegacySeconds = FPlatformTime::Seconds() - LegacyStart;
+
+		int64 CompiledChecksum = 0;
+		const double CompiledStart = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const FVMPaneHit Hit = Compiled.FindPaneAt(Samples[i & 4095]);
+			CompiledChecksum += Hit.LocalPlayerIndex + (Hit.bReceivesKeyboardMouse ? 1 : 0);
+		}
+		const double CompiledSeconds = FPlatformTime::Seconds() - CompiledStart;
+
+		UE_LOG(LogViewportManager, Display, TEXT("vm.Bench.HitTest panes=%d iterations=%d legacy=%.1fns/op compiled=%.1fns/op speedup=%.2fx (checksums %lld/%lld)"),
+			Compiled.Num(), Iterations,
+			LegacySeconds * 1.0e9 / Iterations,
+			CompiledSeconds * 1.0e9 / Iterations,
+			CompiledSeconds > 0.0 ? LegacySeconds / CompiledSeconds : 0.0,
+			LegacyChecksum, CompiledChecksum);
+	}
+
+	static FAutoConsoleCommand HitTestCommand(
+		TEXT("vm.Bench.HitTest"),
+		TEXT("Times pane hit testing against the compiled layout versus the map-based lookup. Usage: vm.Bench.HitTest [NumPanes=16] [Iterations=1000000]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunHitTestBenchmark));
+
+	static UWorld* FindGameWorld()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+			{
+				return Context.World();
+			}
+		}
+		return nullptr;
+	}
+
+	/**
+	 * Runs Frames full world ticks and returns the average milliseconds per tick. Timing World->Tick
+	 * keeps the tick task dispatch around each pawn tick in the per-pawn numbers.
+	 */
+	template <typename FrameFunc>
+	static double MeasureWorldTicks(UWorld* World, int32 Frames, FrameFunc&& BeforeTick)
+	{
+		double Seconds = 0.0;
+		for (int32 Frame = 0; Frame < Frames; ++Frame)
+		{
+			BeforeTick(Frame);
+			const double Start = FPlatformTime::Seconds();
+			World->Tick(LEVELTICK_All, 1.0f / 60.0f);
+			Seconds += FPlatformTime::Seconds() - Start;
+		}
+		return Seconds * 1000.0 / Frames;
+	}
+
+	static void RunCameraUpdateBenchmark(const TArray<FString>& Args)
+	{
+		const int32 NumCameras = Args.Num() > 0 ? FMath::Clamp(FCString::Atoi(*Args[0]), 1, 256) : 8;
+		const int32 Frames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 500;
+
+		UWorld* World = FindGameWorld();
+		if (!World || World->bInTick)
+		{
+			UE_LOG(LogViewportManager, Warning, TEXT("vm.Bench.CameraUpdate needs a running game or PIE world outside of its tick"));
+			return;
+		}
+
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		TArray<ATargetPoint*> Targets;
+		TArray<AVMCameraPawn*> Cameras;
+		for (int32 i = 0; i < NumCameras; ++i)
+		{
+			ATargetPoint* Target = World->SpawnActor<ATargetPoint>(FVector(i * 1000.0, 0.0, 0.0), FRotator::ZeroRotator, SpawnParams);
+			AVMCameraPawn* Camera = World->SpawnActor<AVMCameraPawn>(FVector(i * 1000.0, 0.0, 0.0), FRotator::ZeroRotator, SpawnParams);
+			if (!Target || !Camera)
+			{
+				continue;
+			}
+
+			Camera->SetTargetActor(Target);
+			Targets.Add(Target);
+			Cameras.Add(Camera);
+		}
+
+		// Same motion for every run: a quarter of the targets move each frame, the rest stand still
+		FRandomStream Stream(0x564D);
+		auto MoveTargets = [&Targets, &Stream](int32 Frame)
+		{
+			for (int32 i = Frame % 4; i < Targets.Num(); i += 4)
+			{
+				Targets[i]->AddActorWorldOffset(FVector(Stream.FRandRange(5.0f, 20.0f), 0.0f, 0.0f));
+			}
+		};
+
+		// Asleep cameras neither tick nor sit in the batch, which isolates the rest of the world's tick
+		for (AVMCameraPawn* Camera : Cameras)
+		{
+			Camera->SetCameraAsleep(true);
+		}
+		const double BaselineMs = MeasureWorldTicks(World, Frames, MoveTargets);
+
+		for (AVMCameraPawn* Camera : Cameras)
+		{
+			Camera->SetUseCameraUpdateSubsystem(false);
+			Camera->SetCameraAsleep(false);
+		}
+		const double PerPawnMs = MeasureWorldTicks(World, Frames, MoveTargets);
+
+		for (AVMCameraPawn* Camera : Cameras)
+		{
+			Camera->SetUseCameraUpdateSubsystem(true);
+		}
+		const double BatchedMs = MeasureWorldTicks(World, Frames, MoveTargets);
+
+		for (int32 i = 0; i < Cameras.Num(); ++i)
+		{
+			Cameras[i]->Destroy();
+			Targets[i]->Destroy();
+		}
+
+		// Camera cost is each run's world tick minus the run with every camera asleep
+		const double PerPawnCostUs = FMath::Max(PerPawnMs - BaselineMs, 0.0) * 1000.0;
+		const double BatchedCostUs = FMath::Max(BatchedMs - BaselineMs, 0.0) * 1000.0;
+		UE_LOG(LogViewportManager, Display, TEXT("vm.Bench.CameraUpdate cameras=%d frames=%d world tick: asleep=%.3fms per-pawn=%.3fms batched=%.3fms; camera cost per-pawn=%.2fus batched=%.2fus speedup=%.2fx"),
+			Cameras.Num(), Frames, BaselineMs, PerPawnMs, BatchedMs, PerPawnCostUs, BatchedCostUs,
+			BatchedCostUs > 0.0 ? PerPawnCostUs / BatchedCostUs : 0.0);
+	}
+
+	static FAutoConsoleCommand CameraUpdateCommand(
+		TEXT("vm.Bench.CameraUpdate"),
+		TEXT("Times full world ticks with cameras tracking through their own actor ticks versus the camera update subsystem, against a run with the cameras asleep. Needs a game world. Usage: vm.Bench.CameraUpdate [NumCameras=8] [Frames=500]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunCameraUpdateBenchmark));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMBenchmarks
+{
+	/** Layout of NumPanes UI-only panes in a grid; exercises the per-pane bookkeeping without players or pawns. */
+	static UVMSplitLayoutAsset* CreateUIOnlyLayout(int32 NumPanes)
+	{
+		UVMSplitLayoutAsset* Layout = CreateGridLayout(NumPanes + 1);
+		Layout->Panes.RemoveAt(Layout->Panes.Num() - 1);
+		for (FVMSplitPane& Pane : Layout->Panes)
+		{
+			Pane.bUIOnly = true;
+		}
+		return Layout;
+	}
+
+	/** One measured value and the limit it is held to; a limit of zero is reported but never fails. */
+	struct FSuiteResult
+	{
+		FString Metric;
+		double Value = 0.0;
+		FString Unit;
+		bool bHigherIsBetter = false;
+		double Limit = 0.0;
+
+		bool Passed() const { return Limit <= 0.0 || (bHigherIsBetter ? Value >= Limit : Value <= Limit); }
+	};
+
+	/**
+	 * Built-in limits derived from the frame budget: a full apply fits in half of a 60 Hz frame, a rect
+	 * drag relayouts every frame so it gets a small slice of one, and routing an input event stays under 1us.
+	 * A -VMBenchThresholds= file with "metric,limit" lines overrides them; -VMBenchCalibrate writes one.
+	 */
+	static TMap<FString, double> GetDefaultSuiteLimits()
+	{
+		TMap<FString, double> Limits;
+		for (const int32 NumPanes : { 1, 2, 4, 8 })
+		{
+			Limits.Add(FString::Printf(TEXT("apply_layout.%d.p95"), NumPanes), 8.0);
+			Limits.Add(FString::Printf(TEXT("set_pane_rect.%d.p95"), NumPanes), 0.5);
+		}
+		Limits.Add(TEXT("apply_layout.ui64.p95"), 2.0);
+		Limits.Add(TEXT("apply_layout.ui256.p95"), 8.0);
+		Limits.Add(TEXT("input_key.4"), 1000000.0);
+		Limits.Add(TEXT("input_axis.4"), 1000000.0);
+		return Limits;
+	}
+
+	static bool LoadSuiteLimits(const FString& Path, TMap<FString, double>& Limits)
+	{
+		TArray<FString> Lines;
+		if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+		{
+			return false;
+		}
+
+		for (const FString& Line : Lines)
+		{
+			FString Metric, Limit;
+			if (!Line.StartsWith(TEXT("#")) && Line.Split(TEXT(","), &Metric, &Limit))
+			{
+				Limits.Add(Metric.TrimStartAndEnd(), FCString::Atod(*Limit.TrimStartAndEnd()));
+			}
+		}
+		return true;
+	}
+
+	/** Writes a limit for every limited metric with headroom over this run: 1.5x latency, two thirds of throughput. */
+	static bool WriteCalibratedLimits(const FString& Path, const TArray<FSuiteResult>& Results)
+	{
+		FString Output = TEXT("# metric,limit calibrated by ViewportManager.Performance.Suite\n");
+		for (const FSuiteResult& Result : Results)
+		{
+			if (Result.Limit > 0.0)
+			{
+				Output += FString::Printf(TEXT("%s,%.4f\n"), *Result.Metric, Result.bHigherIsBetter ? Result.Value * 2.0 / 3.0 : Result.Value * 1.5);
+			}
+		}
+		return FFileHelper::SaveStringToFile(Output, *Path);
+	}
+
+	static double GetPercentile(TArray<double>& Samples, double Percentile)
+	{
+		if (Samples.Num() == 0)
+		{
+			return 0.0;
+		}
+		Samples.Sort();
+		return Samples[FMath::Clamp(FMath::CeilToInt(Percentile * Samples.Num()) - 1, 0, Samples.Num() - 1)];
+	}
+
+	static void AddLatencyResults(TArray<FSuiteResult>& Results, const FString& Metric, TArray<double>& SampleMs)
+	{
+		Results.Add({ Metric + TEXT(".p50"), GetPercentile(SampleMs, 0.5), TEXT("ms") });
+		Results.Add({ Metric + TEXT(".p95"), GetPercentile(SampleMs, 0.95), TEXT("ms") });
+	}
+
+	/** Applies Layout Iterations times, each time after applying Baseline so every timed apply does real work. */
+	static void MeasureApplyLayout(UVMSplitSubsystem& Subsystem, UVMSplitLayoutAsset* Layout, UVMSplitLayoutAsset* Baseline,
+		int32 Iterations, TArray<double>& OutSampleMs)
+	{
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			Subsystem.ApplyLayout(Baseline);
+
+			const double Start = FPlatformTime::Seconds();
+			Subsystem.ApplyLayout(Layout);
+			OutSampleMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+		}
+	}
+
+	/** Moves the first pane back and forth between two rects; each move is one relayout. */
+	static void MeasureSetPaneRect(UVMSplitSubsystem& Subsystem, const UVMSplitLayoutAsset& Layout, int32 Iterations, TArray<double>& OutSampleMs)
+	{
+		const FVMSplitRect Rect = Layout.Panes[0].Rect;
+		for (int32 i = 0; i < Iterations; ++i)
+		{
+			const float Shrink = (i & 1) ? 0.0f : 0.01f;
+
+			const double Start = FPlatformTime::Seconds();
+			Subsystem.SetPaneRect(Layout.Panes[0].LocalPlayerIndex, Rect.Origin01.X, Rect.Origin01.Y, Rect.Size01.X - Shrink, Rect.Size01.Y - Shrink);
+			OutSampleMs.Add((FPlatformTime::Seconds() - Start) * 1000.0);
+		}
+	}
+
+	/** Events per second through InputKey (press and release pairs) or InputAxis (mouse X deltas). */
+	static double MeasureInputThroughput(UVMGameViewportClient& ViewportClient, bool bAxis, int32 NumEvents)
+	{
+		FInputKeyEventArgs KeyArgs(ViewportClient.Viewport, 0, bAxis ? EKeys::MouseX : EKeys::A, IE_Pressed);
+		KeyArgs.AmountDepressed = 1.0f;
+		KeyArgs.NumSamples = 1;
+
+		const double Start = FPlatformTime::Seconds();
+		for (int32 i = 0; i < NumEvents; ++i)
+		{
+			if (bAxis)
+			{
+				ViewportClient.InputAxis(KeyArgs);
+			}
+			else
+			{
+				KeyArgs.Event = (i & 1) ? IE_Released : IE_Pressed;
+				ViewportClient.InputKey(KeyArgs);
+			}
+		}
+		const double Seconds = FPlatformTime::Seconds() - Start;
+		return Seconds > 0.0 ? NumEvents / Seconds : 0.0;
+	}
+
+	static bool WriteSuiteResults(const FString& Path, const TArray<FSuiteResult>& Results)
+	{
+		const bool bJson = Path.EndsWith(TEXT(".json"));
+
+		FString Output = bJson ? TEXT("[\n") : TEXT("metric,value,unit,limit,passed\n");
+		for (int32 i = 0; i < Results.Num(); ++i)
+		{
+			const FSuiteResult& Result = Results[i];
+			if (bJson)
+			{
+				Output += FString::Printf(TEXT("  {\"metric\": \"%s\", \"value\": %.4f, \"unit\": \"%s\", \"limit\": %.4f, \"passed\": %s}%s\n"),
+					*Result.Metric, Result.Value, *Result.Unit, Result.Limit, Result.Passed() ? TEXT("true") : TEXT("false"),
+					i + 1 < Results.Num() ? TEXT(",") : TEXT(""));
+			}
+			else
+			{
+				Output += FString::Printf(TEXT("%s,%.4f,%s,%.4f,%d\n"), *Result.Metric, Result.Value, *Result.Unit, Result.Limit, Result.Passed() ? 1 : 0);
+			}
+		}
+		if (bJson)
+		{
+			Output += TEXT("]\n");
+		}
+
+		return FFileHelper::SaveStringToFile(Output, *Path);
+	}
+}
+
+/**
+ * Times ApplyLayout, SetPaneRect and input routing on synthetic 1/2/4/8-pane and large UI-only layouts and
+ * fails on any metric over its limit. Needs a game with UVMGameViewportClient; for CI run it with -game -nullrhi
+ * and -ExecCmds="Automation RunTests ViewportManager.Performance; Quit". Replaces the current layout while it runs.
+ * Command line options: -VMBenchOut=<csv or json path> -VMBenchThresholds=<csv of metric,limit> -VMBenchIterations=50
+ * -VMBenchCalibrate (writes measured limits to the thresholds path instead of checking them).
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMBenchmarkSuiteTest, "ViewportManager.Performance.Suite",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::PerfFilter)
+
+bool FVMBenchmarkSuiteTest::RunTest(const FString& Parameters)
+{
+	using namespace VMBenchmarks;
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ViewportManager"),
+		FString::Printf(TEXT("Benchmarks-%s.csv"), *FDateTime::Now().ToString()));
+	FParse::Value(CommandLine, TEXT("VMBenchOut="), OutputPath);
+
+	int32 Iterations = 50;
+	FParse::Value(CommandLine, TEXT("VMBenchIterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	FString ThresholdsPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("ViewportManager"), TEXT("BenchmarkThresholds.csv"));
+	const bool bCustomThresholds = FParse::Value(CommandLine, TEXT("VMBenchThresholds="), ThresholdsPath);
+	const bool bCalibrate = FParse::Param(CommandLine, TEXT("VMBenchCalibrate"));
+
+	UWorld* World = FindGameWorld();
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	UVMGameViewportClient* ViewportClient = GameInstance ? Cast<UVMGameViewportClient>(GameInstance->GetGameViewportClient()) : nullptr;
+	UVMSplitSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<UVMSplitSubsystem>() : nullptr;
+	if (!ViewportClient || !Subsystem)
+	{
+		AddError(TEXT("Needs a game running with UVMGameViewportClient (for CI: -game -nullrhi)"));
+		return false;
+	}
+
+	if (Subsystem->IsLayoutEditOpen())
+	{
+		AddError(TEXT("A layout edit is open; SetPaneRect would be deferred until it commits"));
+		return false;
+	}
+
+	TMap<FString, double> Limits = GetDefaultSuiteLimits();
+	if (bCustomThresholds && !bCalibrate && !LoadSuiteLimits(ThresholdsPath, Limits))
+	{
+		AddError(FString::Printf(TEXT("Could not read thresholds from %s"), *ThresholdsPath));
+		return false;
+	}
+
+	// Staged applies only queue a non-incremental apply, which would time the enqueue instead of the apply
+	UVMViewportManagerSettings* Settings = GetMutableDefault<UVMViewportManagerSettings>();
+	TGuardValue<bool> SynchronousApply(Settings->bUseStagedLayoutApply, false);
+
+	// Coalesced mouse axis events are only summed until the next world tick, so route each one as it arrives
+	const bool bWasCoalescingMouseAxis = ViewportClient->IsMouseAxisCoalescingEnabled();
+	ViewportClient->SetMouseAxisCoalescingEnabled(false);
+
+	UVMSplitLayoutAsset* OriginalLayout = ViewportClient->GetCurrentLayout();
+	UVMSplitLayoutAsset* Baseline = CreateUIOnlyLayout(1);
+	TArray<FSuiteResult> Results;
+
+	for (const int32 NumPanes : { 1, 2, 4, 8 })
+	{
+		UVMSplitLayoutAsset* Layout = CreateGridLayout(NumPanes);
+
+		// The first apply creates the local players; keep it out of the samples
+		Subsystem->ApplyLayout(Layout);
+
+		TArray<double> ApplySampleMs;
+		MeasureApplyLayout(*Subsystem, Layout, Baseline, Iterations, ApplySampleMs);
+		AddLatencyResults(Results, FString::Printf(TEXT("apply_layout.%d"), NumPanes), ApplySampleMs);
+
+		TArray<double> RectSampleMs;
+		MeasureSetPaneRect(*Subsystem, *Layout, Iterations, RectSampleMs);
+		AddLatencyResults(Results, FString::Printf(TEXT("set_pane_rect.%d"), NumPanes), RectSampleMs);
+
+		if (NumPanes == 4)
+		{
+			// Focused routing so the numbers do not depend on where a headless cursor happens to be
+			ViewportClient->SetInputRoute(EVMInputDeviceType::Keyboard, 0, EVMInputRoutingPolicy::FocusedPane);
+			ViewportClient->SetInputRoute(EVMInputDeviceType::Mouse, 0, EVMInputRoutingPolicy::FocusedPane);
+
+			const int32 NumEvents = Iterations * 2000;
+			Results.Add({ TEXT("input_key.4"), MeasureInputThroughput(*ViewportClient, false, NumEvents), TEXT("events/s"), true });
+			Results.Add({ TEXT("input_axis.4"), MeasureInputThroughput(*ViewportClient, true, NumEvents), TEXT("events/s"), true });
+
+			// Route overrides outlive layout applies, so they would otherwise stay on after the suite
+			ViewportClient->ResetInputRoutes();
+		}
+	}
+
+	for (const int32 NumPanes : { 64, 256 })
+	{
+		TArray<double> ApplySampleMs;
+		MeasureApplyLayout(*Subsystem, CreateUIOnlyLayout(NumPanes), Baseline, Iterations, ApplySampleMs);
+		AddLatencyResults(Results, FString::Printf(TEXT("apply_layout.ui%d"), NumPanes), ApplySampleMs);
+	}
+
+	if (OriginalLayout)
+	{
+		Subsystem->ApplyLayout(OriginalLayout);
+	}
+	ViewportClient->SetMouseAxisCoalescingEnabled(bWasCoalescingMouseAxis);
+
+	for (FSuiteResult& Result : Results)
+	{
+		if (const double* Limit = Limits.Find(Result.Metric))
+		{
+			Result.Limit = *Limit;
+		}
+
+		AddTelemetryData(Result.Metric, Result.Value, Result.Unit);
+		if (bCalibrate)
+		{
+			AddInfo(FString::Printf(TEXT("%s = %.4f %s"), *Result.Metric, Result.Value, *Result.Unit));
+		}
+		else if (Result.Limit > 0.0)
+		{
+			TestTrue(FString::Printf(TEXT("%s = %.4f %s within limit %.4f"), *Result.Metric, Result.Value, *Result.Unit, Result.Limit), Result.Passed());
+		}
+	}
+
+	if (bCalibrate)
+	{
+		TestTrue(FString::Printf(TEXT("Calibrated limits written to %s"), *ThresholdsPath), WriteCalibratedLimits(ThresholdsPath, Results));
+	}
+
+	TestTrue(FString::Printf(TEXT("Results written to %s"), *OutputPath), WriteSuiteResults(OutputPath, Results));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+#endif // !UE_BUILD_SHIPPING
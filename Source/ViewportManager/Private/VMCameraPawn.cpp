@@ -4,10 +4,16 @@
 #include "Components/InputComponent.h"
 #include "EnhancedInputComponent.h"
 #include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 #include "VMLog.h"
+#include "VMStats.h"
+#include "VMPaneCosts.h"
 #include "VMSplitLayoutAsset.h"
+#include "VMCameraUpdateSubsystem.h"
+#include "VMGameViewportClient.h"
 
 AVMCameraPawn::AVMCameraPawn()
 {
@@ -29,9 +35,6 @@ AVMCameraPawn::AVMCameraPawn()
 	Camera->bUsePawnControlRotation = false;
 
 	FocusPoint = FVector::ZeroVector;
-	TargetLocation = FVector::ZeroVector;
-	TargetRotation = FRotator::ZeroRotator;
-	TargetOrbitDistance = StartingOrbitDistance;
 
 	DefaultOrbitSensitivity = OrbitSensitivity;
 	DefaultPanSpeed = PanSpeed;
@@ -52,15 +55,119 @@ void AVMCameraPawn::BeginPlay()
 		SpringArm->TargetArmLength = StartingOrbitDistance;
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::BeginPlay - Camera at %s, Controller rotation: %s, OrbitDistance: %.2f"),
+	if (UVMCameraUpdateSubsystem* CameraUpdates = GetWorld()->GetSubsystem<UVMCameraUpdateSubsystem>())
+	{
+		CameraUpdates->RegisterCamera(this);
+		bTrackedByCameraUpdateSubsystem = true;
+
+		// Blueprint subclasses with an Event Tick keep ticking; the rest leave tracking to the subsystem
+		bTicksForBlueprint = PrimaryActorTick.bStartWithTickEnabled && IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(AVMCameraPawn, ReceiveTick));
+		SetActorTickEnabled(NeedsTick());
+	}
+	else
+	{
+		SetActorTickEnabled(true);
+	}
+
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::BeginPlay - Camera at %s, Controller rotation: %s, OrbitDistance: %.2f"),
 		*GetActorLocation().ToString(), *GetControlRotation().ToString(), StartingOrbitDistance);
 }
 
+void AVMCameraPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelFocusTrace();
+
+	if (bTrackedByCameraUpdateSubsystem)
+	{
+		if (UVMCameraUpdateSubsystem* CameraUpdates = GetWorld()->GetSubsystem<UVMCameraUpdateSubsystem>())
+		{
+			CameraUpdates->UnregisterCamera(this);
+		}
+		bTrackedByCameraUpdateSubsystem = false;
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void AVMCameraPawn::Tick(float DeltaTime)
 {
+	VM_SCOPE_CYCLE_COUNTER(STAT_VM_CameraPawnTick);
+	VM_PANE_COST_SCOPE(EVMPaneCost::Pawn, FVMPaneCosts::FindLocalPlayerIndex(this));
+
 	Super::Tick(DeltaTime);
 
-	UpdateTargetTracking();
+	if (!bTrackedByCameraUpdateSubsystem)
+	{
+		UpdateTargetTracking();
+	}
+
+	if (Smoother.IsAwake())
+	{
+		UpdateSmoothMovement(DeltaTime);
+	}
+}
+
+void AVMCameraPawn::RefreshCameraUpdate()
+{
+	if (bTrackedByCameraUpdateSubsystem)
+	{
+		if (UVMCameraUpdateSubsystem* CameraUpdates = GetWorld()->GetSubsystem<UVMCameraUpdateSubsystem>())
+		{
+			CameraUpdates->RefreshCamera(this);
+		}
+	}
+}
+
+void AVMCameraPawn::SetCameraAsleep(bool bAsleep)
+{
+	const bool bChanged = bCameraAsleep != bAsleep;
+	bCameraAsleep = bAsleep;
+
+	if (bChanged && bTrackedByCameraUpdateSubsystem)
+	{
+		if (UVMCameraUpdateSubsystem* CameraUpdates = GetWorld()->GetSubsystem<UVMCameraUpdateSubsystem>())
+		{
+			if (bAsleep)
+			{
+				CameraUpdates->UnregisterCamera(this);
+			}
+			else
+			{
+				CameraUpdates->RegisterCamera(this);
+			}
+		}
+	}
+
+	// A generic wake restores the class default, which is wrong both for batched pawns at rest and for a smoother mid-move
+	SetActorTickEnabled(NeedsTick());
+}
+
+void AVMCameraPawn::SetUseCameraUpdateSubsystem(bool bUse)
+{
+	UVMCameraUpdateSubsystem* CameraUpdates = HasActorBegunPlay() ? GetWorld()->GetSubsystem<UVMCameraUpdateSubsystem>() : nullptr;
+	if (!CameraUpdates || bUse == bTrackedByCameraUpdateSubsystem)
+	{
+		return;
+	}
+
+	bTrackedByCameraUpdateSubsystem = bUse;
+
+	// Asleep pawns stay out of the batch until they wake
+	if (bUse && !bCameraAsleep)
+	{
+		CameraUpdates->RegisterCamera(this);
+	}
+	else if (!bUse)
+	{
+		CameraUpdates->UnregisterCamera(this);
+	}
+
+	SetActorTickEnabled(NeedsTick());
+}
+
+bool AVMCameraPawn::NeedsTick() const
+{
+	return !bCameraAsleep && (Smoother.IsAwake() || !bTrackedByCameraUpdateSubsystem || bTicksForBlueprint);
 }
 
 void AVMCameraPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputComponent)
@@ -79,12 +186,12 @@ void AVMCameraPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputCompon
 			EnhancedInputComponent->BindAction(IA_PanButton, ETriggerEvent::Completed, this, &AVMCameraPawn::OnPanButtonInput);
 			EnhancedInputComponent->BindAction(IA_LeftMouseButton, ETriggerEvent::Started, this, &AVMCameraPawn::OnLeftMouseButtonInput);
 
-			UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn: Using Enhanced Input bindings"));
+			UE_LOG(LogVMCamera, Log, TEXT("AVMCameraPawn: Using Enhanced Input bindings"));
 			return;
 		}
 		else
 		{
-			UE_LOG(LogViewportManager, Warning, TEXT("AVMCameraPawn: Enhanced Input available but InputActions not assigned, falling back to legacy input"));
+			UE_LOG(LogVMCamera, Warning, TEXT("AVMCameraPawn: Enhanced Input available but InputActions not assigned, falling back to legacy input"));
 		}
 	}
 
@@ -97,7 +204,7 @@ void AVMCameraPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputCompon
 	PlayerInputComponent->BindAction("MiddleMouseButton", IE_Released, this, &AVMCameraPawn::OnMiddleMouseReleased);
 	PlayerInputComponent->BindAction("LeftMouseButton", IE_Pressed, this, &AVMCameraPawn::OnLeftMousePressed);
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn: Using legacy input bindings"));
+	UE_LOG(LogVMCamera, Log, TEXT("AVMCameraPawn: Using legacy input bindings"));
 }
 
 void AVMCameraPawn::ZoomStep(float WheelDelta)
@@ -107,7 +214,7 @@ void AVMCameraPawn::ZoomStep(float WheelDelta)
 	if (bUseDistanceBasedZoom && SpringArm)
 	{
 		float ZoomAmount = EffectiveDelta * ZoomDistanceMultiplier;
-		float NewDistance = SpringArm->TargetArmLength - ZoomAmount;
+		float NewDistance = GetOrbitDistance() - ZoomAmount;
 		SetOrbitDistance(NewDistance);
 
 		if (TargetActor && IsValid(TargetActor))
@@ -115,11 +222,18 @@ void AVMCameraPawn::ZoomStep(float WheelDelta)
 			FVector ActorLocation = TargetActor->GetActorLocation();
 			if (!FocusPoint.Equals(ActorLocation, 1.0f))
 			{
-				FocusPoint = ActorLocation;
-				SetActorLocation(ActorLocation);
+				FollowTarget(ActorLocation);
 			}
 		}
 	}
+	else if (bUseSmoothMovement)
+	{
+		// Successive wheel steps accumulate on the goal, not on the value still in flight
+		FVMCameraSmoothingState& Goal = BeginSmoothing();
+		Goal.Zoom = bUseOrthographic
+			? FMath::Clamp(Goal.Zoom - (EffectiveDelta * ZoomSpeed * 10.0f), MinOrthoWidth, MaxOrthoWidth)
+			: FMath::Clamp(Goal.Zoom - (EffectiveDelta * ZoomSpeed), MinFOV, MaxFOV);
+	}
 	else if (bUseOrthographic)
 	{
 		float NewOrthoWidth = OrthoWidth - (EffectiveDelta * ZoomSpeed * 10.0f);
@@ -135,21 +249,29 @@ void AVMCameraPawn::ZoomStep(float WheelDelta)
 
 void AVMCameraPawn::OrbitDelta(float DeltaYawDeg, float DeltaPitchDeg)
 {
-	FRotator CurrentRotation = GetControlRotation();
-	FRotator NewRotation = CurrentRotation + FRotator(DeltaPitchDeg, DeltaYawDeg, 0.0f);
+	if (bUseSmoothMovement)
+	{
+		FVMCameraSmoothingState& Goal = BeginSmoothing();
+		Goal.Yaw += DeltaYawDeg;
+		Goal.Pitch = FMath::Clamp(Goal.Pitch + DeltaPitchDeg, -89.0f, 89.0f);
+	}
+	else
+	{
+		FRotator CurrentRotation = GetControlRotation();
+		FRotator NewRotation = CurrentRotation + FRotator(DeltaPitchDeg, DeltaYawDeg, 0.0f);
 
-	// Clamp pitch to prevent flipping
-	NewRotation.Pitch = FMath::Clamp(NewRotation.Pitch, -89.0f, 89.0f);
+		// Clamp pitch to prevent flipping
+		NewRotation.Pitch = FMath::Clamp(NewRotation.Pitch, -89.0f, 89.0f);
 
-	GetController()->SetControlRotation(NewRotation);
+		GetController()->SetControlRotation(NewRotation);
+	}
 
 	if (TargetActor && IsValid(TargetActor))
 	{
 		FVector ActorLocation = TargetActor->GetActorLocation();
 		if (!FocusPoint.Equals(ActorLocation, 1.0f))
 		{
-			FocusPoint = ActorLocation;
-			SetActorLocation(ActorLocation);
+			FollowTarget(ActorLocation);
 		}
 	}
 }
@@ -171,7 +293,15 @@ void AVMCameraPawn::PanDelta(float DeltaRight, float DeltaUp)
 
 	FVector PanMovement = (RightVector * DeltaRight) + (UpVector * DeltaUp);
 
-	if (TargetActor && IsValid(TargetActor))
+	if (bUseSmoothMovement)
+	{
+		BeginSmoothing().Focus += PanMovement;
+		if (!TargetActor || !IsValid(TargetActor))
+		{
+			FocusPoint += PanMovement;
+		}
+	}
+	else if (TargetActor && IsValid(TargetActor))
 	{
 		FVector NewLocation = GetActorLocation() + PanMovement;
 		SetActorLocation(NewLocation);
@@ -187,9 +317,17 @@ void AVMCameraPawn::PanDelta(float DeltaRight, float DeltaUp)
 void AVMCameraPawn::SetFocusPoint(FVector World)
 {
 	FocusPoint = World;
-	SetActorLocation(World);
+	if (bUseSmoothMovement)
+	{
+		BeginSmoothing().Focus = World;
+	}
+	else
+	{
+		SetActorLocation(World);
+	}
+	RefreshCameraUpdate();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetFocusPoint - Set focus point to %s"), *World.ToString());
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetFocusPoint - Set focus point to %s"), *World.ToString());
 }
 
 void AVMCameraPawn::SetOrbitDistance(float Distance)
@@ -197,14 +335,27 @@ void AVMCameraPawn::SetOrbitDistance(float Distance)
 	if (SpringArm)
 	{
 		float ClampedDistance = FMath::Clamp(Distance, MinOrbitDistance, MaxOrbitDistance);
-		SpringArm->TargetArmLength = ClampedDistance;
+		if (bUseSmoothMovement)
+		{
+			BeginSmoothing().ArmLength = ClampedDistance;
+		}
+		else
+		{
+			SpringArm->TargetArmLength = ClampedDistance;
+		}
 		
-		UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetOrbitDistance - Set orbit distance to %.2f"), ClampedDistance);
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetOrbitDistance - Set orbit distance to %.2f"), ClampedDistance);
 	}
 }
 
 float AVMCameraPawn::GetOrbitDistance() const
 {
+	// While smoothing, report where the arm is heading so successive zoom steps accumulate
+	if (Smoother.IsAwake())
+	{
+		return Smoother.GetGoal().ArmLength;
+	}
+
 	if (SpringArm)
 	{
 		return SpringArm->TargetArmLength;
@@ -314,29 +465,80 @@ void AVMCameraPawn::OnLeftMousePressed()
 	{
 		if (APlayerController* PC = Cast<APlayerController>(GetController()))
 		{
+			if (TargetActor && IsValid(TargetActor))
+			{
+				UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn: Left click ignored - target actor is set"));
+				return;
+			}
+
 			FVector WorldLocation, WorldDirection;
 			if (PC->DeprojectMousePositionToWorld(WorldLocation, WorldDirection))
 			{
-				FHitResult HitResult;
-				FVector TraceEnd = WorldLocation + (WorldDirection * 10000.0f);
+				FVector TraceEnd = WorldLocation + (WorldDirection * FocusTraceLength);
 
-				if (GetWorld()->LineTraceSingleByChannel(HitResult, WorldLocation, TraceEnd, ECC_Visibility))
+				if (!FocusTraceDelegate.IsBound())
 				{
-					if (!TargetActor || !IsValid(TargetActor))
-					{
-						SetFocusPoint(HitResult.Location);
-						UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn: Set focus point to %s"), *HitResult.Location.ToString());
-					}
-					else
-					{
-						UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn: Left click ignored - target actor is set"));
-					}
+					FocusTraceDelegate.BindUObject(this, &AVMCameraPawn::OnFocusTraceDone);
 				}
+
+				// A newer click supersedes any trace still in flight
+				FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(VMClickToFocus), false, this);
+				PendingFocusTrace = GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, WorldLocation, TraceEnd, FocusTraceChannel,
+					QueryParams, FCollisionResponseParams::DefaultResponseParam, &FocusTraceDelegate);
 			}
 		}
 	}
 }
 
+void AVMCameraPawn::OnFocusTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum)
+{
+	if (TraceHandle != PendingFocusTrace)
+	{
+		return;
+	}
+	PendingFocusTrace = FTraceHandle();
+
+	// The world may have moved on during the frame the trace was in flight
+	if (bDisableViewportFocusing || !bCameraControlsEnabled || (TargetActor && IsValid(TargetActor)) || !IsInFocusedPane())
+	{
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn: Click-to-focus result discarded - pane no longer accepts focus changes"));
+		return;
+	}
+
+	const FHitResult* HitResult = TraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit) { return Hit.bBlockingHit; });
+	if (HitResult)
+	{
+		SetFocusPoint(HitResult->Location);
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn: Set focus point to %s"), *HitResult->Location.ToString());
+	}
+}
+
+void AVMCameraPawn::CancelFocusTrace()
+{
+	// The engine still completes the trace, but a cleared handle never matches it
+	PendingFocusTrace = FTraceHandle();
+}
+
+bool AVMCameraPawn::IsInFocusedPane() const
+{
+	const APlayerController* PC = Cast<APlayerController>(GetController());
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	if (!LocalPlayer)
+	{
+		return false;
+	}
+
+	// Without a Viewport Manager viewport there is only one pane, and it always has focus
+	const UVMGameViewportClient* VMViewportClient = Cast<UVMGameViewportClient>(LocalPlayer->ViewportClient);
+	if (!VMViewportClient)
+	{
+		return true;
+	}
+
+	const UGameInstance* GameInstance = GetGameInstance();
+	return GameInstance && GameInstance->GetLocalPlayerByIndex(VMViewportClient->GetFocusedPlayer()) == LocalPlayer;
+}
+
 void AVMCameraPawn::UpdateCameraProjection()
 {
 	if (Camera)
@@ -374,6 +576,7 @@ FVector AVMCameraPawn::GetCameraUpVector() const
 
 void AVMCameraPawn::SetTargetActor(AActor* Actor)
 {
+	StopSmoothing();
 	TargetActor = Actor;
 
 	if (TargetActor)
@@ -388,13 +591,15 @@ void AVMCameraPawn::SetTargetActor(AActor* Actor)
 			SpringArm->TargetArmLength = FMath::Max(MinOrbitDistance, 300.0f);
 		}
 
-		UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetTargetActor - Set target actor: %s at location %s, orbit distance: %.2f"),
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetTargetActor - Set target actor: %s at location %s, orbit distance: %.2f"),
 			*TargetActor->GetName(), *ActorLocation.ToString(), SpringArm ? SpringArm->TargetArmLength : 0.0f);
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetTargetActor - Cleared target actor"));
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetTargetActor - Cleared target actor"));
 	}
+
+	RefreshCameraUpdate();
 }
 
 void AVMCameraPawn::ZoomToDistance(float Distance)
@@ -406,6 +611,8 @@ void AVMCameraPawn::FocusOnActor(AActor* Actor, float Distance)
 {
 	if (Actor)
 	{
+		StopSmoothing();
+
 		TargetActor = Actor;
 		FVector ActorLocation = Actor->GetActorLocation();
 
@@ -423,13 +630,16 @@ void AVMCameraPawn::FocusOnActor(AActor* Actor, float Distance)
 			PawnController->SetControlRotation(LookAtRotation);
 		}
 
-		UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::FocusOnActor - Focused on %s at location %s, distance %.2f, rotation %s"),
+		RefreshCameraUpdate();
+
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::FocusOnActor - Focused on %s at location %s, distance %.2f, rotation %s"),
 			*Actor->GetName(), *ActorLocation.ToString(), FinalDistance, *LookAtRotation.ToString());
 	}
 }
 
 void AVMCameraPawn::ResetToStartingPosition()
 {
+	StopSmoothing();
 	SetActorLocation(StartingLocation);
 	GetController()->SetControlRotation(StartingRotation);
 	if (SpringArm)
@@ -439,16 +649,19 @@ void AVMCameraPawn::ResetToStartingPosition()
 
 	FocusPoint = StartingLocation;
 	TargetActor = nullptr;
+	RefreshCameraUpdate();
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::ResetToStartingPosition - Reset camera to starting position"));
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::ResetToStartingPosition - Reset camera to starting position"));
 }
 
 void AVMCameraPawn::SetCameraMode(bool bOrthographic)
 {
+	// The zoom channel means FOV or ortho width depending on the mode, so never carry it across a switch
+	StopSmoothing();
 	bUseOrthographic = bOrthographic;
 	UpdateCameraProjection();
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetCameraMode - Set camera mode to %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetCameraMode - Set camera mode to %s"),
 		bOrthographic ? TEXT("Orthographic") : TEXT("Perspective"));
 }
 
@@ -459,11 +672,101 @@ void AVMCameraPawn::UpdateTargetTracking()
 		FVector ActorLocation = TargetActor->GetActorLocation();
 		if (!FocusPoint.Equals(ActorLocation, 1.0f))
 		{
-			SetFocusPoint(ActorLocation);
+			FollowTarget(ActorLocation);
 		}
 	}
 }
 
+void AVMCameraPawn::FollowTarget(const FVector& InTargetLocation)
+{
+	FocusPoint = InTargetLocation;
+	if (bUseSmoothMovement)
+	{
+		BeginSmoothing().Focus = InTargetLocation;
+	}
+	else
+	{
+		SetActorLocation(InTargetLocation);
+	}
+}
+
+FVMCameraSmoothingState& AVMCameraPawn::BeginSmoothing()
+{
+	if (!Smoother.IsAwake())
+	{
+		// Seed from what is on screen, since anything may have moved the camera while the smoother slept
+		Smoother.SetFrequency(SmoothMovementSpeed * 2.0f);
+		Smoother.Reset(ReadSmoothingState());
+	}
+
+	if (!IsActorTickEnabled())
+	{
+		SetActorTickEnabled(true);
+	}
+
+	return Smoother.EditGoal();
+}
+
+void AVMCameraPawn::StopSmoothing()
+{
+	if (Smoother.IsAwake())
+	{
+		Smoother.Reset(ReadSmoothingState());
+	}
+}
+
+void AVMCameraPawn::UpdateSmoothMovement(float DeltaTime)
+{
+	const bool bStillMoving = Smoother.Advance(DeltaTime);
+	ApplySmoothingState(Smoother.GetCurrent());
+
+	// At rest the smoother costs nothing; the pawn keeps ticking only where it tracks its own target
+	if (!bStillMoving && !NeedsTick())
+	{
+		SetActorTickEnabled(false);
+	}
+}
+
+FVMCameraSmoothingState AVMCameraPawn::ReadSmoothingState() const
+{
+	FVMCameraSmoothingState State;
+	State.Focus = GetActorLocation();
+
+	const FRotator ControlRotation = GetControlRotation();
+	State.Yaw = ControlRotation.Yaw;
+	State.Pitch = FRotator::NormalizeAxis(ControlRotation.Pitch);
+
+	State.ArmLength = SpringArm ? SpringArm->TargetArmLength : StartingOrbitDistance;
+	State.Zoom = bUseOrthographic ? OrthoWidth : (Camera ? Camera->FieldOfView : 90.0f);
+	return State;
+}
+
+void AVMCameraPawn::ApplySmoothingState(const FVMCameraSmoothingState& State)
+{
+	SetActorLocation(State.Focus);
+
+	if (AController* PawnController = GetController())
+	{
+		const FRotator ControlRotation = PawnController->GetControlRotation();
+		PawnController->SetControlRotation(FRotator(State.Pitch, State.Yaw, ControlRotation.Roll));
+	}
+
+	if (SpringArm)
+	{
+		SpringArm->TargetArmLength = State.ArmLength;
+	}
+
+	if (bUseOrthographic)
+	{
+		OrthoWidth = State.Zoom;
+		Camera->SetOrthoWidth(OrthoWidth);
+	}
+	else if (Camera)
+	{
+		Camera->SetFieldOfView(State.Zoom);
+	}
+}
+
 FVector AVMCameraPawn::GetCurrentFocusPoint() const
 {
 	if (TargetActor && IsValid(TargetActor))
@@ -478,7 +781,7 @@ void AVMCameraPawn::SetStartingPosition(FVector Location, FRotator Rotation)
 	StartingLocation = Location;
 	StartingRotation = Rotation;
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetStartingPosition - Set starting position: %s, rotation: %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetStartingPosition - Set starting position: %s, rotation: %s"),
 		*StartingLocation.ToString(), *StartingRotation.ToString());
 }
 
@@ -497,7 +800,7 @@ void AVMCameraPawn::SetupStartingPosition()
 		StartingRotation = GetActorRotation();
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetupStartingPosition - Starting position: %s, rotation: %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetupStartingPosition - Starting position: %s, rotation: %s"),
 		*StartingLocation.ToString(), *StartingRotation.ToString());
 }
 
@@ -511,7 +814,7 @@ void AVMCameraPawn::EnableDirectCameraPositioning(bool bEnable)
 		Camera->SetupAttachment(RootComponent);
 		Camera->bUsePawnControlRotation = true;
 
-		UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::EnableDirectCameraPositioning - ENABLED direct positioning, controller rotation: %s"),
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::EnableDirectCameraPositioning - ENABLED direct positioning, controller rotation: %s"),
 			*GetControlRotation().ToString());
 	}
 	else if (!bEnable && Camera && SpringArm)
@@ -520,18 +823,20 @@ void AVMCameraPawn::EnableDirectCameraPositioning(bool bEnable)
 		Camera->SetupAttachment(SpringArm, USpringArmComponent::SocketName);
 		Camera->bUsePawnControlRotation = false;
 
-		UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::EnableDirectCameraPositioning - DISABLED direct positioning, using spring arm"));
+		UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::EnableDirectCameraPositioning - DISABLED direct positioning, using spring arm"));
 	}
 }
 
 void AVMCameraPawn::SetCameraControlsEnabled(bool bEnabled)
 {
 	bCameraControlsEnabled = bEnabled;
+	RefreshCameraUpdate();
 
 	if (!bEnabled)
 	{
 		bIsOrbiting = false;
 		bIsPanning = false;
+		CancelFocusTrace();
 
 		if (APlayerController* PC = Cast<APlayerController>(GetController()))
 		{
@@ -540,7 +845,7 @@ void AVMCameraPawn::SetCameraControlsEnabled(bool bEnabled)
 		}
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetCameraControlsEnabled - Camera controls %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetCameraControlsEnabled - Camera controls %s"),
 		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
@@ -559,7 +864,7 @@ void AVMCameraPawn::SetOrbitEnabled(bool bEnabled)
 		}
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetOrbitEnabled - Orbit controls %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetOrbitEnabled - Orbit controls %s"),
 		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
@@ -578,7 +883,7 @@ void AVMCameraPawn::SetPanEnabled(bool bEnabled)
 		}
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetPanEnabled - Pan controls %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetPanEnabled - Pan controls %s"),
 		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
@@ -586,15 +891,16 @@ void AVMCameraPawn::SetZoomEnabled(bool bEnabled)
 {
 	bZoomEnabled = bEnabled;
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetZoomEnabled - Zoom controls %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetZoomEnabled - Zoom controls %s"),
 		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
 void AVMCameraPawn::SetTargetActorTrackingEnabled(bool bEnabled)
 {
 	bTargetActorTrackingEnabled = bEnabled;
+	RefreshCameraUpdate();
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetTargetActorTrackingEnabled - Target actor tracking %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetTargetActorTrackingEnabled - Target actor tracking %s"),
 		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
@@ -619,7 +925,7 @@ void AVMCameraPawn::SetKeepMouseCursorVisible(bool bVisible)
 		}
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMCameraPawn::SetKeepMouseCursorVisible - Mouse cursor visibility %s"),
+	UE_LOG(LogVMCamera, Verbose, TEXT("AVMCameraPawn::SetKeepMouseCursorVisible - Mouse cursor visibility %s"),
 		bVisible ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
 
@@ -0,0 +1,96 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMCameraSmoothing.h"
+
+namespace VMCameraSmoothing
+{
+	static constexpr float PositionTolerance = 0.01f;
+	static constexpr float VelocityTolerance = 0.01f;
+
+	// Frame times rarely sum to an exact multiple of the step; this much slack keeps 8 x 1/240 equal to 1/30
+	static constexpr double StepSlack = 1.0e-3;
+
+	/** Exact critically damped step of Value toward Goal over H seconds; Decay is exp(-Omega * H). */
+	template <typename T>
+	static void StepSpring(T& Value, T& Velocity, const T& Goal, float Omega, float H, float Decay)
+	{
+		const T Offset = Value - Goal;
+		const T Impulse = (Velocity + Offset * Omega) * H;
+		Value = Goal + (Offset + Impulse) * Decay;
+		Velocity = (Velocity - Impulse * Omega) * Decay;
+	}
+}
+
+FVMCameraSmoother::FVMCameraSmoother()
+{
+	SetFrequency(Frequency);
+}
+
+void FVMCameraSmoother::SetFrequency(float InFrequency)
+{
+	Frequency = FMath::Max(InFrequency, 0.1f);
+	StepDecay = FMath::Exp(-Frequency * StepSeconds);
+}
+
+void FVMCameraSmoother::Reset(const FVMCameraSmoothingState& State)
+{
+	Current = State;
+	Goal = State;
+	Velocity = FVMCameraSmoothingState();
+	Accumulator = 0.0;
+	bAwake = false;
+}
+
+FVMCameraSmoothingState& FVMCameraSmoother::EditGoal()
+{
+	bAwake = true;
+	return Goal;
+}
+
+bool FVMCameraSmoother::Advance(float DeltaTime)
+{
+	if (!bAwake)
+	{
+		return false;
+	}
+
+	Accumulator += FMath::Clamp(DeltaTime, 0.0f, MaxAdvanceSeconds);
+	const int32 NumSteps = FMath::FloorToInt32(Accumulator / StepSeconds + VMCameraSmoothing::StepSlack);
+	Accumulator = FMath::Max(Accumulator - NumSteps * static_cast<double>(StepSeconds), 0.0);
+
+	for (int32 i = 0; i < NumSteps; ++i)
+	{
+		Step();
+
+		if (HasConverged())
+		{
+			Reset(Goal);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FVMCameraSmoother::Step()
+{
+	using VMCameraSmoothing::StepSpring;
+
+	StepSpring(Current.Focus, Velocity.Focus, Goal.Focus, Frequency, StepSeconds, StepDecay);
+	StepSpring(Current.Yaw, Velocity.Yaw, Goal.Yaw, Frequency, StepSeconds, StepDecay);
+	StepSpring(Current.Pitch, Velocity.Pitch, Goal.Pitch, Frequency, StepSeconds, StepDecay);
+	StepSpring(Current.ArmLength, Velocity.ArmLength, Goal.ArmLength, Frequency, StepSeconds, StepDecay);
+	StepSpring(Current.Zoom, Velocity.Zoom, Goal.Zoom, Frequency, StepSeconds, StepDecay);
+	++TotalSteps;
+}
+
+bool FVMCameraSmoother::HasConverged() const
+{
+	using namespace VMCameraSmoothing;
+
+	return Current.Focus.Equals(Goal.Focus, PositionTolerance) && Velocity.Focus.IsNearlyZero(VelocityTolerance)
+		&& FMath::IsNearlyEqual(Current.Yaw, Goal.Yaw, PositionTolerance) && FMath::IsNearlyZero(Velocity.Yaw, VelocityTolerance)
+		&& FMath::IsNearlyEqual(Current.Pitch, Goal.Pitch, PositionTolerance) && FMath::IsNearlyZero(Velocity.Pitch, VelocityTolerance)
+		&& FMath::IsNearlyEqual(Current.ArmLength, Goal.ArmLength, PositionTolerance) && FMath::IsNearlyZero(Velocity.ArmLength, VelocityTolerance)
+		&& FMath::IsNearlyEqual(Current.Zoom, Goal.Zoom, PositionTolerance) && FMath::IsNearlyZero(Velocity.Zoom, VelocityTolerance);
+}
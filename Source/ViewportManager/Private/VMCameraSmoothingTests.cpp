@@ -0,0 +1,137 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VMCameraSmoothing.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMCameraSmoothingTests
+{
+	static FVMCameraSmoothingState MakeState(const FVector& Focus, float Yaw, float Pitch, float ArmLength, float Zoom)
+	{
+		FVMCameraSmoothingState State;
+		State.Focus = Focus;
+		State.Yaw = Yaw;
+		State.Pitch = Pitch;
+		State.ArmLength = ArmLength;
+		State.Zoom = Zoom;
+		return State;
+	}
+
+	/** A smoother at rest at a typical start pose with a goal one orbit, pan and zoom away. */
+	static FVMCameraSmoother MakeMovingSmoother()
+	{
+		FVMCameraSmoother Smoother;
+		Smoother.SetFrequency(10.0f);
+		Smoother.Reset(MakeState(FVector::ZeroVector, 0.0f, -30.0f, 1000.0f, 90.0f));
+		Smoother.EditGoal() = MakeState(FVector(500.0f, -250.0f, 100.0f), 135.0f, -60.0f, 400.0f, 60.0f);
+		return Smoother;
+	}
+
+	static void AdvanceAtFrameRate(FVMCameraSmoother& Smoother, int32 FramesPerSecond, float Seconds)
+	{
+		const int32 NumFrames = FMath::RoundToInt32(Seconds * FramesPerSecond);
+		for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+		{
+			Smoother.Advance(1.0f / FramesPerSecond);
+		}
+	}
+
+	/** Exact comparison; the fixed substep must make results independent of the frame rate, not merely close. */
+	static void TestIdentical(FAutomationTestBase& Test, const TCHAR* What, const FVMCameraSmoothingState& Actual, const FVMCameraSmoothingState& Expected)
+	{
+		Test.TestTrue(FString::Printf(TEXT("%s: Focus"), What), Actual.Focus == Expected.Focus);
+		Test.TestTrue(FString::Printf(TEXT("%s: Yaw"), What), Actual.Yaw == Expected.Yaw);
+		Test.TestTrue(FString::Printf(TEXT("%s: Pitch"), What), Actual.Pitch == Expected.Pitch);
+		Test.TestTrue(FString::Printf(TEXT("%s: ArmLength"), What), Actual.ArmLength == Expected.ArmLength);
+		Test.TestTrue(FString::Printf(TEXT("%s: Zoom"), What), Actual.Zoom == Expected.Zoom);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCameraSmoothingFrameRateTest, "ViewportManager.Camera.Smoothing.FrameRateIndependence",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCameraSmoothingFrameRateTest::RunTest(const FString& Parameters)
+{
+	using namespace VMCameraSmoothingTests;
+
+	// Half a second in is well before convergence, so both runs are mid-flight
+	FVMCameraSmoother At30 = MakeMovingSmoother();
+	FVMCameraSmoother At240 = MakeMovingSmoother();
+	AdvanceAtFrameRate(At30, 30, 0.5f);
+	AdvanceAtFrameRate(At240, 240, 0.5f);
+
+	TestTrue(TEXT("30 FPS run still moving after 0.5s"), At30.IsAwake());
+	TestTrue(TEXT("240 FPS run still moving after 0.5s"), At240.IsAwake());
+	TestEqual(TEXT("30 and 240 FPS run the same number of substeps"), At30.GetTotalSteps(), At240.GetTotalSteps());
+	TestIdentical(*this, TEXT("30 and 240 FPS states"), At30.GetCurrent(), At240.GetCurrent());
+
+	FVMCameraSmoother AtUneven = MakeMovingSmoother();
+	for (int32 Frame = 0; Frame < 30; ++Frame)
+	{
+		AtUneven.Advance((Frame % 2) ? 0.025f : (1.0f / 120.0f));
+	}
+	TestTrue(TEXT("Uneven frame times keep the smoother awake"), AtUneven.IsAwake());
+	TestTrue(TEXT("Uneven frame times keep advancing"), AtUneven.GetCurrent().ArmLength < 1000.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCameraSmoothingSettleTest, "ViewportManager.Camera.Smoothing.Settle",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCameraSmoothingSettleTest::RunTest(const FString& Parameters)
+{
+	using namespace VMCameraSmoothingTests;
+
+	// No channel may pass its goal when starting from rest
+	FVMCameraSmoother Settling = MakeMovingSmoother();
+	const FVMCameraSmoothingState Goal = Settling.GetGoal();
+	bool bOvershot = false;
+	float SettleSeconds = 0.0f;
+	while (Settling.IsAwake() && SettleSeconds < 10.0f)
+	{
+		Settling.Advance(1.0f / 60.0f);
+		SettleSeconds += 1.0f / 60.0f;
+
+		const FVMCameraSmoothingState& Current = Settling.GetCurrent();
+		bOvershot |= Current.Focus.X > Goal.Focus.X || Current.Yaw > Goal.Yaw || Current.Pitch < Goal.Pitch
+			|| Current.ArmLength < Goal.ArmLength || Current.Zoom < Goal.Zoom;
+	}
+
+	TestFalse(TEXT("Critically damped springs do not overshoot"), bOvershot);
+	TestFalse(TEXT("Smoother goes to sleep once converged"), Settling.IsAwake());
+	TestTrue(TEXT("Frequency 10 settles within 1.5s"), SettleSeconds < 1.5f);
+	TestIdentical(*this, TEXT("Sleeping smoother rests on the goal"), Settling.GetCurrent(), Goal);
+
+	const int32 StepsAtRest = Settling.GetTotalSteps();
+	TestFalse(TEXT("Advancing while asleep reports no movement"), Settling.Advance(1.0f));
+	TestEqual(TEXT("Advancing while asleep runs no substeps"), Settling.GetTotalSteps(), StepsAtRest);
+
+	Settling.EditGoal().ArmLength += 100.0f;
+	TestTrue(TEXT("Editing the goal wakes the smoother"), Settling.IsAwake());
+	TestTrue(TEXT("Woken smoother moves on the next advance"), Settling.Advance(1.0f / 60.0f));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMCameraSmoothingHitchTest, "ViewportManager.Camera.Smoothing.HitchClamp",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMCameraSmoothingHitchTest::RunTest(const FString& Parameters)
+{
+	using namespace VMCameraSmoothingTests;
+
+	// A long hitch is clamped instead of running seconds of substeps at once
+	FVMCameraSmoother Hitched = MakeMovingSmoother();
+	Hitched.Advance(5.0f);
+
+	const int32 MaxHitchSteps = FMath::RoundToInt32(FVMCameraSmoother::MaxAdvanceSeconds / FVMCameraSmoother::StepSeconds);
+	TestTrue(TEXT("Hitches are clamped to MaxAdvanceSeconds"), Hitched.GetTotalSteps() <= MaxHitchSteps);
+	TestTrue(TEXT("A clamped hitch still advances"), Hitched.GetTotalSteps() > 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
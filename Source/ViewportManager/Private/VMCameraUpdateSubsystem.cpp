@@ -0,0 +1,107 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMCameraUpdateSubsystem.h"
+#include "VMCameraPawn.h"
+#include "Engine/World.h"
+#include "VMStats.h"
+#include "VMPaneCosts.h"
+
+void FVMCameraUpdateBatch::Add(AVMCameraPawn* Camera)
+{
+	if (!Camera || Cameras.Contains(Camera))
+	{
+		return;
+	}
+
+	Cameras.Add(Camera);
+	Targets.AddDefaulted();
+	FocusPoints.Add(Camera->FocusPoint);
+	Refresh(Camera);
+}
+
+void FVMCameraUpdateBatch::Remove(AVMCameraPawn* Camera)
+{
+	const int32 Slot = Cameras.IndexOfByKey(Camera);
+	if (Slot != INDEX_NONE)
+	{
+		Cameras.RemoveAtSwap(Slot);
+		Targets.RemoveAtSwap(Slot);
+		FocusPoints.RemoveAtSwap(Slot);
+	}
+}
+
+void FVMCameraUpdateBatch::Refresh(AVMCameraPawn* Camera)
+{
+	const int32 Slot = Cameras.IndexOfByKey(Camera);
+	if (Slot == INDEX_NONE)
+	{
+		return;
+	}
+
+	const bool bTracking = Camera->bCameraControlsEnabled && Camera->bTargetActorTrackingEnabled && IsValid(Camera->TargetActor);
+	Targets[Slot] = bTracking ? Camera->TargetActor.Get() : nullptr;
+	FocusPoints[Slot] = Camera->FocusPoint;
+}
+
+int32 FVMCameraUpdateBatch::Update()
+{
+	MovedSlots.Reset();
+
+	// Read pass: only targets are touched, cameras stay cold unless their target moved
+	for (int32 Slot = 0; Slot < Targets.Num(); ++Slot)
+	{
+		const AActor* Target = Targets[Slot].Get();
+		if (!Target)
+		{
+			continue;
+		}
+
+		const FVector TargetLocation = Target->GetActorLocation();
+		if (!FocusPoints[Slot].Equals(TargetLocation, 1.0f))
+		{
+			FocusPoints[Slot] = TargetLocation;
+			MovedSlots.Add(Slot);
+		}
+	}
+
+	// Write pass
+	for (const int32 Slot : MovedSlots)
+	{
+		if (AVMCameraPawn* Camera = Cameras[Slot].Get())
+		{
+			VM_PANE_COST_SCOPE(EVMPaneCost::Pawn, FVMPaneCosts::FindLocalPlayerIndex(Camera));
+			Camera->FollowTarget(FocusPoints[Slot]);
+		}
+	}
+
+	// Pawns normally unregister in EndPlay; drop any that were destroyed without it
+	for (int32 Slot = Cameras.Num() - 1; Slot >= 0; --Slot)
+	{
+		if (!Cameras[Slot].IsValid())
+		{
+			Cameras.RemoveAtSwap(Slot);
+			Targets.RemoveAtSwap(Slot);
+			FocusPoints.RemoveAtSwap(Slot);
+		}
+	}
+
+	return MovedSlots.Num();
+}
+
+void UVMCameraUpdateSubsystem::Tick(float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR("STAT_VM_CameraUpdateSubsystem", ViewportManagerChannel);
+
+	LastMovedCameras = Batch.Update();
+}
+
+TStatId UVMCameraUpdateSubsystem::GetStatId() const
+{
+	// The tickable manager scopes Tick with this stat
+	return GET_STATID(STAT_VM_CameraUpdateSubsystem);
+}
+
+bool UVMCameraUpdateSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
@@ -0,0 +1,92 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMCompiledLayout.h"
+
+void FVMCompiledLayout::Compile(const UVMSplitLayoutAsset& Layout)
+{
+	Reset();
+
+	const int32 NumPanes = Layout.Panes.Num();
+	MinX.Reserve(NumPanes);
+	MinY.Reserve(NumPanes);
+	MaxX.Reserve(NumPanes);
+	MaxY.Reserve(NumPanes);
+	LocalPlayerIndices.Reserve(NumPanes);
+	PaneIndices.Reserve(NumPanes);
+	Flags.Reserve(NumPanes);
+
+	// First occurrence of a LocalPlayerIndex wins, matching ApplyLayout.
+	TSet<int32> UsedIndices;
+	TArray<int32, TInlineAllocator<16>> Accepted;
+	for (int32 PaneIndex = 0; PaneIndex < NumPanes; ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = Layout.Panes[PaneIndex];
+		if (!Pane.NeedsLocalPlayer() || Pane.LocalPlayerIndex < 0 || UsedIndices.Contains(Pane.LocalPlayerIndex))
+		{
+			continue;
+		}
+
+		UsedIndices.Add(Pane.LocalPlayerIndex);
+		Accepted.Add(PaneIndex);
+	}
+
+	// Store top-most first so FindPaneAt can stop at the first hit.
+	for (int32 i = Accepted.Num() - 1; i >= 0; --i)
+	{
+		const int32 PaneIndex = Accepted[i];
+		const FVMSplitPane& Pane = Layout.Panes[PaneIndex];
+
+		MinX.Add(Pane.Rect.Origin01.X);
+		MinY.Add(Pane.Rect.Origin01.Y);
+		MaxX.Add(Pane.Rect.Origin01.X + Pane.Rect.Size01.X);
+		MaxY.Add(Pane.Rect.Origin01.Y + Pane.Rect.Size01.Y);
+		LocalPlayerIndices.Add(Pane.LocalPlayerIndex);
+		PaneIndices.Add(PaneIndex);
+		Flags.Add(Pane.bReceivesKeyboardMouse ? ReceivesKeyboardMouse : None);
+	}
+}
+
+void FVMCompiledLayout::Reset()
+{
+	MinX.Reset();
+	MinY.Reset();
+	MaxX.Reset();
+	MaxY.Reset();
+	LocalPlayerIndices.Reset();
+	PaneIndices.Reset();
+	Flags.Reset();
+}
+
+FVMPaneHit FVMCompiledLayout::FindPaneAt(const FVector2D& ScreenPosition01) const
+{
+	const float X = static_cast<float>(ScreenPosition01.X);
+	const float Y = static_cast<float>(ScreenPosition01.Y);
+
+	FVMPaneHit Hit;
+	const int32 Count = LocalPlayerIndices.Num();
+	for (int32 Slot = 0; Slot < Count; ++Slot)
+	{
+		if (X >= MinX[Slot] && X <= MaxX[Slot] && Y >= MinY[Slot] && Y <= MaxY[Slot])
+		{
+			Hit.LocalPlayerIndex = LocalPlayerIndices[Slot];
+			Hit.PaneIndex = PaneIndices[Slot];
+			Hit.bReceivesKeyboardMouse = (Flags[Slot] & ReceivesKeyboardMouse) != 0;
+			break;
+		}
+	}
+
+	return Hit;
+}
+
+int32 FVMCompiledLayout::FindSlotForPlayer(int32 LocalPlayerIndex) const
+{
+	return LocalPlayerIndices.IndexOfByKey(LocalPlayerIndex);
+}
+
+FVMSplitRect FVMCompiledLayout::GetRect(int32 Slot) const
+{
+	FVMSplitRect Rect;
+	Rect.Origin01 = FVector2f(MinX[Slot], MinY[Slot]);
+	Rect.Size01 = FVector2f(MaxX[Slot] - MinX[Slot], MaxY[Slot] - MinY[Slot]);
+	return Rect;
+}
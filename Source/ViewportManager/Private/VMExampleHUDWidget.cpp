@@ -29,7 +29,7 @@ void UVMExampleHUDWidget::NativeConstruct()
 
 	UpdateHUDDisplay();
 
-	UE_LOG(LogViewportManager, Log, TEXT("UVMExampleHUDWidget::NativeConstruct - Example HUD constructed for LocalPlayer %d"), GetLocalPlayerIndex());
+	UE_LOG(LogVMHUD, Log, TEXT("UVMExampleHUDWidget::NativeConstruct - Example HUD constructed for LocalPlayer %d"), GetLocalPlayerIndex());
 }
 
 void UVMExampleHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
@@ -41,7 +41,7 @@ void UVMExampleHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaT
 
 void UVMExampleHUDWidget::OnTestButtonClicked()
 {
-	UE_LOG(LogViewportManager, Log, TEXT("UVMExampleHUDWidget::OnTestButtonClicked - Button clicked for LocalPlayer %d"), GetLocalPlayerIndex());
+	UE_LOG(LogVMHUD, Log, TEXT("UVMExampleHUDWidget::OnTestButtonClicked - Button clicked for LocalPlayer %d"), GetLocalPlayerIndex());
 
 	if (HealthBar)
 	{
@@ -134,7 +134,7 @@ void UVMExampleHUDWidget::CreateUIElements()
 			TestButton->AddChild(ButtonText);
 		}
 
-		UE_LOG(LogViewportManager, Log, TEXT("UVMExampleHUDWidget::CreateUIElements - Created UI elements programmatically for LocalPlayer %d"), GetLocalPlayerIndex());
+		UE_LOG(LogVMHUD, Log, TEXT("UVMExampleHUDWidget::CreateUIElements - Created UI elements programmatically for LocalPlayer %d"), GetLocalPlayerIndex());
 	}
 }
 
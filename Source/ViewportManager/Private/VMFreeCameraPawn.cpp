@@ -8,6 +8,7 @@
 #include "GameFramework/PlayerController.h"
 #include "VMSplitLayoutAsset.h"
 #include "VMLog.h"
+#include "VMPaneCosts.h"
 
 AVMFreeCameraPawn::AVMFreeCameraPawn()
 {
@@ -40,6 +41,8 @@ void AVMFreeCameraPawn::BeginPlay()
 
 void AVMFreeCameraPawn::Tick(float DeltaSeconds)
 {
+	VM_PANE_COST_SCOPE(EVMPaneCost::Pawn, FVMPaneCosts::FindLocalPlayerIndex(this));
+
 	Super::Tick(DeltaSeconds);
 }
 
@@ -62,12 +65,12 @@ void AVMFreeCameraPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputCo
 			EnhancedInputComponent->BindAction(IA_Look, ETriggerEvent::Triggered, this, &AVMFreeCameraPawn::OnLookInput);
 			EnhancedInputComponent->BindAction(IA_Sprint, ETriggerEvent::Started, this, &AVMFreeCameraPawn::OnSprintInput);
 			EnhancedInputComponent->BindAction(IA_Sprint, ETriggerEvent::Completed, this, &AVMFreeCameraPawn::OnSprintInput);
-			UE_LOG(LogViewportManager, Log, TEXT("AVMFreeCameraPawn: Using Enhanced Input bindings"));
+			UE_LOG(LogVMCamera, Log, TEXT("AVMFreeCameraPawn: Using Enhanced Input bindings"));
 			return;
 		}
 		else
 		{
-			UE_LOG(LogViewportManager, Warning, TEXT("AVMFreeCameraPawn: Enhanced Input available but InputActions not assigned, falling back to legacy input"));
+			UE_LOG(LogVMCamera, Warning, TEXT("AVMFreeCameraPawn: Enhanced Input available but InputActions not assigned, falling back to legacy input"));
 		}
 	}
 
@@ -79,7 +82,7 @@ void AVMFreeCameraPawn::SetupPlayerInputComponent(UInputComponent* PlayerInputCo
 	PlayerInputComponent->BindAxis("LookUp", this, &AVMFreeCameraPawn::LookPitch);
 	PlayerInputComponent->BindAction("LeftShift", IE_Pressed, this, &AVMFreeCameraPawn::StartSprint);
 	PlayerInputComponent->BindAction("LeftShift", IE_Released, this, &AVMFreeCameraPawn::StopSprint);
-	UE_LOG(LogViewportManager, Log, TEXT("AVMFreeCameraPawn: Using legacy input bindings"));
+	UE_LOG(LogVMCamera, Log, TEXT("AVMFreeCameraPawn: Using legacy input bindings"));
 }
 
 void AVMFreeCameraPawn::MoveForward(float Value)
@@ -19,7 +19,20 @@
 #include "Blueprint/WidgetTree.h"
 #include "Framework/Application/SlateApplication.h"
 #include "InputCoreTypes.h"
+#include "Engine/Canvas.h"
+#include "CanvasItem.h"
+#include "Curves/CurveFloat.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "VMPaneResolution.h"
+#include "VMPaneSceneViewExtension.h"
+#include "SceneViewExtension.h"
 #include "VMLog.h"
+#include "VMStats.h"
+#include "EngineUtils.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/UObjectIterator.h"
 
 UVMGameViewportClient::UVMGameViewportClient()
 {
@@ -30,12 +43,45 @@ UVMGameViewportClient::UVMGameViewportClient()
 	HUDRootCanvas = nullptr;
 	bClickToFocusEnabled = true;
 	bFocusHighlightingEnabled = false;
+
+	if (!HasAnyFlags(RF_ClassDefaultObject))
+	{
+		if (const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>())
+		{
+			SetMouseAxisCoalescingEnabled(Settings->bCoalesceMouseAxisInput);
+		}
+	}
+}
+
+void UVMGameViewportClient::BeginDestroy()
+{
+	PendingAxisInputs.Reset();
+#if VM_WITH_PANE_COSTS
+	ControllerTickTimers.Reset();
+#endif
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	WorldTickStartHandle.Reset();
+
+	// r.ScreenPercentage is global, so a lowered value would otherwise outlive this client, e.g. after PIE ends
+	if (bOverridingScreenPercentage)
+	{
+		if (IConsoleVariable* CVarScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage")))
+		{
+			CVarScreenPercentage->Set(SavedScreenPercentage, ECVF_SetByCode);
+		}
+		bOverridingScreenPercentage = false;
+	}
+
+	Super::BeginDestroy();
 }
 
 void UVMGameViewportClient::LayoutPlayers()
 {
+	VM_SCOPE_CYCLE_COUNTER(STAT_VM_LayoutPlayers);
+
 	if (!CurrentLayoutAsset || PlayerRects.Num() == 0)
 	{
+		WakeAllDormantPanes();
 		Super::LayoutPlayers();
 		return;
 	}
@@ -43,20 +89,59 @@ void UVMGameViewportClient::LayoutPlayers()
 	UGameInstance* LocalGameInstance = GetGameInstance();
 	if (!LocalGameInstance)
 	{
+		WakeAllDormantPanes();
 		Super::LayoutPlayers();
 		return;
 	}
 
+	// Called every frame from Draw, so transitions are advanced here with one blend per pane and no relayout
+	const bool bTransitioning = IsLayoutTransitionActive();
+	float TransitionTime01 = 1.0f;
+	float TransitionAlpha = 1.0f;
+	if (bTransitioning)
+	{
+		TransitionTime01 = static_cast<float>(FMath::Clamp((FPlatformTime::Seconds() - TransitionStartTime) / TransitionDuration, 0.0, 1.0));
+		TransitionAlpha = TransitionCurve ? TransitionCurve->GetFloatValue(TransitionTime01) : FMath::SmoothStep(0.0f, 1.0f, TransitionTime01);
+	}
+
 	for (const auto& PlayerRectPair : PlayerRects)
 	{
 		const int32 LocalPlayerIndex = PlayerRectPair.Key;
-		const FVMSplitRect& Rect = PlayerRectPair.Value;
+		FVMSplitRect Rect = PlayerRectPair.Value;
+
+		if (bTransitioning)
+		{
+			if (const FVMSplitRect* FromRect = TransitionFromRects.Find(LocalPlayerIndex))
+			{
+				Rect.Origin01 = FMath::Lerp(FromRect->Origin01, Rect.Origin01, TransitionAlpha);
+				Rect.Size01 = FMath::Lerp(FromRect->Size01, Rect.Size01, TransitionAlpha);
+			}
+
+			const TWeakObjectPtr<UUserWidget>* HUD = ActivePaneHUDs.Find(LocalPlayerIndex);
+			if (UCanvasPanelSlot* Slot = HUD && HUD->IsValid() ? Cast<UCanvasPanelSlot>((*HUD)->Slot) : nullptr)
+			{
+				ApplyHUDSlotRect(Slot, Rect);
+			}
+		}
 
 		if (ULocalPlayer* LocalPlayer = LocalGameInstance->GetLocalPlayerByIndex(LocalPlayerIndex))
 		{
 			LocalPlayer->Origin = FVector2D(Rect.Origin01.X, Rect.Origin01.Y);
 			LocalPlayer->Size = FVector2D(Rect.Size01.X, Rect.Size01.Y);
 		}
+
+		UpdatePaneDormancy(LocalGameInstance, LocalPlayerIndex, Rect.Size01.X <= KINDA_SMALL_NUMBER || Rect.Size01.Y <= KINDA_SMALL_NUMBER);
+	}
+
+	if (bTransitioning && TransitionTime01 >= 1.0f)
+	{
+		StopLayoutTransition();
+
+		// Settle HUDs on the exact target rects and let them refresh their viewport info once
+		for (const auto& PlayerRectPair : PlayerRects)
+		{
+			UpdatePaneHUDRect(PlayerRectPair.Key, PlayerRectPair.Value);
+		}
 	}
 
 	const int32 NumLocalPlayers = LocalGameInstance->GetNumLocalPlayers();
@@ -68,362 +153,1931 @@ void UVMGameViewportClient::LayoutPlayers()
 			{
 				LocalPlayer->Size = FVector2D(0.0f, 0.0f);
 			}
+
+			UpdatePaneDormancy(LocalGameInstance, i, true);
 		}
 	}
 }
 
+void UVMGameViewportClient::UpdatePaneDormancy(UGameInstance* LocalGameInstance, int32 LocalPlayerIndex, bool bHidden)
+{
+	FVMDormantPane* Dormant = DormantPanes.Find(LocalPlayerIndex);
+	if (!bHidden && !Dormant)
+	{
+		return;
+	}
+
+	const ULocalPlayer* LocalPlayer = LocalGameInstance->GetLocalPlayerByIndex(LocalPlayerIndex);
+	APlayerController* PC = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+	APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+	const TWeakObjectPtr<UUserWidget>* ActiveHUD = ActivePaneHUDs.Find(LocalPlayerIndex);
+	UUserWidget* HUD = ActiveHUD ? ActiveHUD->Get() : nullptr;
+
+	if (!bHidden)
+	{
+		// Only wake what is still this player's; a pawn swapped out meanwhile belongs to the pool or was destroyed
+		SetActorDormant(Dormant->Controller == PC ? PC : nullptr, false);
+		SetActorDormant(Dormant->Pawn == Pawn ? Pawn : nullptr, false);
+		SetHUDDormant(Dormant->HUD == HUD ? HUD : nullptr, false);
+
+		DormantPanes.Remove(LocalPlayerIndex);
+		UE_LOG(LogVMLayout, Verbose, TEXT("Pane %d visible again; %d panes dormant"), LocalPlayerIndex, DormantPanes.Num());
+		return;
+	}
+
+	if (!Dormant)
+	{
+		Dormant = &DormantPanes.Add(LocalPlayerIndex);
+		UE_LOG(LogVMLayout, Verbose, TEXT("Pane %d hidden; %d panes dormant"), LocalPlayerIndex, DormantPanes.Num());
+	}
+
+	// Runs every frame while hidden, so a pawn or HUD created after the pane went dormant is put to sleep too
+	if (Dormant->Controller != PC)
+	{
+		SetActorDormant(PC, true);
+		Dormant->Controller = PC;
+	}
+
+	if (Dormant->Pawn != Pawn)
+	{
+		SetActorDormant(Pawn, true);
+		Dormant->Pawn = Pawn;
+	}
+
+	if (Dormant->HUD != HUD)
+	{
+		SetHUDDormant(HUD, true);
+		Dormant->HUD = HUD;
+	}
+}
+
+void UVMGameViewportClient::WakeAllDormantPanes()
+{
+	for (const auto& DormantPair : DormantPanes)
+	{
+		SetActorDormant(DormantPair.Value.Controller.Get(), false);
+		SetActorDormant(DormantPair.Value.Pawn.Get(), false);
+		SetHUDDormant(DormantPair.Value.HUD.Get(), false);
+	}
+	DormantPanes.Reset();
+}
+
+void UVMGameViewportClient::SetActorDormant(AActor* Actor, bool bDormant)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	// Restore the class defaults rather than forcing ticks on, matching how pooled pawns are woken
+	Actor->SetActorTickEnabled(!bDormant && Actor->PrimaryActorTick.bStartWithTickEnabled);
+	Actor->ForEachComponent(false, [bDormant](UActorComponent* Component)
+	{
+		Component->SetComponentTickEnabled(!bDormant && Component->PrimaryComponentTick.bStartWithTickEnabled);
+	});
+
+	if (bDormant)
+	{
+		Actor->DisableInput(nullptr);
+	}
+	else
+	{
+		Actor->EnableInput(nullptr);
+	}
+
+	if (AVMCameraPawn* CameraPawn = Cast<AVMCameraPawn>(Actor))
+	{
+		CameraPawn->SetCameraAsleep(bDormant);
+	}
+}
+
+void UVMGameViewportClient::SetHUDDormant(UUserWidget* HUD, bool bDormant)
+{
+	// Collapsed widgets are neither painted nor ticked
+	if (IsValid(HUD))
+	{
+		HUD->SetVisibility(bDormant ? ESlateVisibility::Collapsed : ESlateVisibility::SelfHitTestInvisible);
+	}
+}
+
 bool UVMGameViewportClient::InputKey(const FInputKeyEventArgs& EventArgs)
 {
-	if (!EventArgs.IsGamepad())
+	VM_SCOPE_CYCLE_COUNTER(STAT_VM_InputKey);
+	INC_DWORD_STAT(STAT_VM_InputEventsIn);
+
+	FVMPaneCostTimer RoutingTimer;
+	RoutingTimer.Start();
+	const FVMInputRoute* Route = InputRouting.FindRoute(EventArgs);
+	RoutingTimer.Stop();
+	if (!Route)
 	{
-		FVector2D MousePos;
-		if (GetMousePosition(MousePos))
-		{
-			const FIntPoint VPSize = Viewport->GetSizeXY();
-			const FVector2D N = FVector2D(MousePos.X / VPSize.X, MousePos.Y / VPSize.Y);
-			const int32 TargetLP = FindPaneAtScreenPosition(N);
+		return Super::InputKey(EventArgs);
+	}
 
-			if (TargetLP != -1)
-			{
-				bool bShouldReceiveInput = true;
-				if (CurrentLayoutAsset)
-				{
-					for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
-					{
-						if (Pane.LocalPlayerIndex == TargetLP)
-						{
-							bShouldReceiveInput = Pane.bReceivesKeyboardMouse;
-							break;
-						}
-					}
-				}
+	// Axis movement that came before this key must reach the controller before it
+	FlushPendingAxisInput();
 
-				if (bShouldReceiveInput)
-				{
-					if (EventArgs.Event == IE_Pressed && EventArgs.Key == EKeys::LeftMouseButton)
-					{
-						HandleClickToFocus(N);
-					}
-
-					if (ULocalPlayer* LP = GetGameInstance()->GetLocalPlayerByIndex(TargetLP))
-					{
-						if (APlayerController* PC = LP->GetPlayerController(GetWorld()))
-						{
-							// Use the new InputKey signature that takes FInputKeyEventArgs
-							FInputKeyEventArgs ModifiedArgs = EventArgs;
-							ModifiedArgs.Viewport = Viewport;
-							ModifiedArgs.ControllerId = LP->GetControllerId();
-							return PC->InputKey(ModifiedArgs);
-						}
-					}
-				}
-			}
+	// Clicking a pane focuses it, which is also what moves FocusedPane routing between panes
+	if (EventArgs.Event == IE_Pressed && EventArgs.Key == EKeys::LeftMouseButton
+		&& (Route->Policy == EVMInputRoutingPolicy::Hover || Route->Policy == EVMInputRoutingPolicy::FocusedPane))
+	{
+		FVector2D N;
+		RoutingTimer.Start();
+		const FVMPaneHit Hit = FindHoveredPane(N);
+		RoutingTimer.Stop();
+		if (Hit.IsValid() && Hit.bReceivesKeyboardMouse)
+		{
+			HandleClickToFocus(Hit.LocalPlayerIndex);
 		}
-		return false;
+
+		// Hover routing reuses the hit instead of testing the same cursor position again
+		return RouteInput(*Route, EventArgs, false, RoutingTimer, &Hit);
 	}
 
-	return Super::InputKey(EventArgs);
+	return RouteInput(*Route, EventArgs, false, RoutingTimer);
 }
 
 bool UVMGameViewportClient::InputAxis(const FInputKeyEventArgs& EventArgs)
 {
-	if (!EventArgs.IsGamepad())
+	VM_SCOPE_CYCLE_COUNTER(STAT_VM_InputAxis);
+	INC_DWORD_STAT(STAT_VM_InputEventsIn);
+
+	FVMPaneCostTimer RoutingTimer;
+	RoutingTimer.Start();
+	const FVMInputRoute* Route = InputRouting.FindRoute(EventArgs);
+	RoutingTimer.Stop();
+	if (!Route)
 	{
-		FVector2D MousePos;
-		if (GetMousePosition(MousePos))
+		return Super::InputAxis(EventArgs);
+	}
+
+	// In UE 5.7+, axis input is handled through the enhanced input system
+	// Route axis input directly to the target player controller (same as InputKey)
+	return RouteInput(*Route, EventArgs, true, RoutingTimer);
+}
+
+FVMPaneHit UVMGameViewportClient::FindHoveredPane(FVector2D& OutPosition01) const
+{
+	FVector2D MousePos;
+	if (!Viewport || !GetMousePosition(MousePos))
+	{
+		return FVMPaneHit();
+	}
+
+	const FIntPoint VPSize = Viewport->GetSizeXY();
+	OutPosition01 = FVector2D(MousePos.X / VPSize.X, MousePos.Y / VPSize.Y);
+
+	// CompiledLayout holds the target rects; mid-transition the panes are drawn somewhere in between
+	return IsLayoutTransitionActive() ? FindTransitioningPaneAt(OutPosition01) : CompiledLayout.FindPaneAt(OutPosition01);
+}
+
+FVMPaneHit UVMGameViewportClient::FindTransitioningPaneAt(const FVector2D& Position01) const
+{
+	FVMPaneHit Hit;
+	const UGameInstance* LocalGameInstance = GetGameInstance();
+	if (!LocalGameInstance)
+	{
+		return Hit;
+	}
+
+	// LayoutPlayers leaves each local player on its blended rect for this frame; slots stay top-most first
+	for (int32 Slot = 0; Slot < CompiledLayout.Num(); ++Slot)
+	{
+		const ULocalPlayer* LP = LocalGameInstance->GetLocalPlayerByIndex(CompiledLayout.GetLocalPlayerIndex(Slot));
+		if (LP && Position01.X >= LP->Origin.X && Position01.X <= LP->Origin.X + LP->Size.X
+			&& Position01.Y >= LP->Origin.Y && Position01.Y <= LP->Origin.Y + LP->Size.Y)
 		{
-			const FIntPoint VPSize = Viewport->GetSizeXY();
-			const FVector2D N = FVector2D(MousePos.X / VPSize.X, MousePos.Y / VPSize.Y);
-			const int32 TargetLP = FindPaneAtScreenPosition(N);
+			Hit.LocalPlayerIndex = CompiledLayout.GetLocalPlayerIndex(Slot);
+			Hit.PaneIndex = CompiledLayout.GetPaneIndex(Slot);
+			Hit.bReceivesKeyboardMouse = (CompiledLayout.GetFlags(Slot) & FVMCompiledLayout::ReceivesKeyboardMouse) != 0;
+			break;
+		}
+	}
 
-			if (TargetLP != -1)
-			{
-				bool bShouldReceiveInput = true;
-				if (CurrentLayoutAsset)
-				{
-					for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
-					{
-						if (Pane.LocalPlayerIndex == TargetLP)
-						{
-							bShouldReceiveInput = Pane.bReceivesKeyboardMouse;
-							break;
-						}
-					}
-				}
+	return Hit;
+}
 
-				if (bShouldReceiveInput)
-				{
-					// In UE 5.7+, axis input is handled through the enhanced input system
-					// Route axis input directly to the target player controller (same as InputKey)
-					if (ULocalPlayer* LP = GetGameInstance()->GetLocalPlayerByIndex(TargetLP))
-					{
-						if (APlayerController* PC = LP->GetPlayerController(GetWorld()))
-						{
-							FInputKeyEventArgs ModifiedArgs = EventArgs;
-							ModifiedArgs.Viewport = Viewport;
-							ModifiedArgs.ControllerId = LP->GetControllerId();
-							return PC->InputKey(ModifiedArgs);
-						}
-					}
-				}
-			}
+bool UVMGameViewportClient::RouteInput(const FVMInputRoute& Route, const FInputKeyEventArgs& EventArgs, bool bAxis, FVMPaneCostTimer& RoutingTimer, const FVMPaneHit* HoveredPane)
+{
+	RoutingTimer.Start();
+
+	// Mouse axes are deltas and can be summed; gamepad axes are absolute positions and cannot
+	const bool bCoalesce = bAxis && bCoalesceMouseAxisInput && EventArgs.Key.IsMouseButton();
+	auto Send = [this, &EventArgs, bCoalesce, &RoutingTimer](int32 LocalPlayerIndex)
+	{
+		// The lookup and hit test belong to the first pane the event reaches
+		RoutingTimer.Attribute(LocalPlayerIndex, EVMPaneCost::Input);
+
+		if (bCoalesce)
+		{
+			QueueAxisInput(LocalPlayerIndex, EventArgs);
+			return true;
+		}
+		return DispatchToPlayer(LocalPlayerIndex, EventArgs);
+	};
+
+	switch (Route.Policy)
+	{
+	case EVMInputRoutingPolicy::Hover:
+	{
+		FVector2D N;
+		const FVMPaneHit Hit = HoveredPane ? *HoveredPane : FindHoveredPane(N);
+		return Hit.IsValid() && Hit.bReceivesKeyboardMouse && Send(Hit.LocalPlayerIndex);
+	}
+	case EVMInputRoutingPolicy::FocusedPane:
+		return CompiledLayout.FindSlotForPlayer(FocusedPlayerIndex) != INDEX_NONE && Send(FocusedPlayerIndex);
+	case EVMInputRoutingPolicy::Fixed:
+		return Route.LocalPlayerIndex != INDEX_NONE && Send(Route.LocalPlayerIndex);
+	case EVMInputRoutingPolicy::Broadcast:
+	{
+		bool bHandled = false;
+		for (const int32 LocalPlayerIndex : InputRouting.GetBroadcastPlayers())
+		{
+			bHandled |= Send(LocalPlayerIndex);
 		}
+		return bHandled;
+	}
+	default:
 		return false;
 	}
+}
+
+void UVMGameViewportClient::SetInputRoute(EVMInputDeviceType Device, int32 GamepadIndex, EVMInputRoutingPolicy Policy, int32 LocalPlayerIndex)
+{
+	if (Policy == EVMInputRoutingPolicy::Fixed && CompiledLayout.FindSlotForPlayer(LocalPlayerIndex) == INDEX_NONE)
+	{
+		UE_LOG(LogVMInput, Warning, TEXT("UVMGameViewportClient::SetInputRoute - LocalPlayerIndex %d has no player pane in the current layout"), LocalPlayerIndex);
+		return;
+	}
+
+	// Pending sums were aimed at the old route
+	FlushPendingAxisInput();
+
+	FVMInputRoute Route;
+	Route.Policy = Policy;
+	Route.LocalPlayerIndex = Policy == EVMInputRoutingPolicy::Fixed ? LocalPlayerIndex : INDEX_NONE;
+	InputRouting.SetRoute(Device, GamepadIndex, Route);
+
+	UE_LOG(LogVMInput, Verbose, TEXT("UVMGameViewportClient::SetInputRoute - %s %d now routed %s"),
+		*UEnum::GetValueAsString(Device), GamepadIndex, *UEnum::GetValueAsString(Policy));
+}
+
+void UVMGameViewportClient::ResetInputRoutes()
+{
+	FlushPendingAxisInput();
+	InputRouting.ResetOverrides();
+
+	if (CurrentLayoutAsset)
+	{
+		InputRouting.Rebuild(*CurrentLayoutAsset, CompiledLayout);
+	}
+	else
+	{
+		InputRouting.Reset();
+	}
+}
+
+bool UVMGameViewportClient::GetInputRoute(EVMInputDeviceType Device, int32 GamepadIndex, FVMInputRoute& OutRoute) const
+{
+	if (const FVMInputRoute* Route = InputRouting.FindRoute(Device, GamepadIndex))
+	{
+		OutRoute = *Route;
+		return true;
+	}
+	return false;
+}
+
+bool UVMGameViewportClient::DispatchToPlayer(int32 LocalPlayerIndex, const FInputKeyEventArgs& EventArgs)
+{
+	if (ULocalPlayer* LP = GetGameInstance()->GetLocalPlayerByIndex(LocalPlayerIndex))
+	{
+		if (APlayerController* PC = LP->GetPlayerController(GetWorld()))
+		{
+			// Use the new InputKey signature that takes FInputKeyEventArgs
+			FInputKeyEventArgs ModifiedArgs = EventArgs;
+			ModifiedArgs.Viewport = Viewport;
+			ModifiedArgs.ControllerId = LP->GetControllerId();
+			INC_DWORD_STAT(STAT_VM_InputEventsRouted);
+			VM_PANE_COST_SCOPE(EVMPaneCost::Input, LocalPlayerIndex);
+			return PC->InputKey(ModifiedArgs);
+		}
+	}
+	return false;
+}
+
+void UVMGameViewportClient::SetMouseAxisCoalescingEnabled(bool bEnabled)
+{
+	if (bEnabled == bCoalesceMouseAxisInput)
+	{
+		return;
+	}
+
+	if (!bEnabled)
+	{
+		FlushPendingAxisInput();
+		FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+		WorldTickStartHandle.Reset();
+	}
+	else
+	{
+		WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UVMGameViewportClient::OnWorldTickStart);
+	}
+
+	bCoalesceMouseAxisInput = bEnabled;
+	UE_LOG(LogVMInput, Log, TEXT("Mouse axis coalescing %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void UVMGameViewportClient::QueueAxisInput(int32 LocalPlayerIndex, const FInputKeyEventArgs& EventArgs)
+{
+	++AxisEventsThisFrame;
+	++InputCoalescingStats.TotalEventsIn;
+
+	for (FVMPendingAxisInput& Pending : PendingAxisInputs)
+	{
+		if (Pending.LocalPlayerIndex == LocalPlayerIndex && Pending.Args.Key == EventArgs.Key)
+		{
+			Pending.Args.AmountDepressed += EventArgs.AmountDepressed;
+			Pending.Args.NumSamples += EventArgs.NumSamples;
+			Pending.Args.DeltaTime = EventArgs.DeltaTime;
+			Pending.Args.EventTimestamp = EventArgs.EventTimestamp;
+			return;
+		}
+	}
+
+	PendingAxisInputs.Emplace(LocalPlayerIndex, EventArgs);
+}
+
+void UVMGameViewportClient::FlushPendingAxisInput()
+{
+	if (PendingAxisInputs.Num() == 0)
+	{
+		return;
+	}
+
+	// Dispatching can re-enter input handling, so work from a local copy
+	TArray<FVMPendingAxisInput> ToDispatch = MoveTemp(PendingAxisInputs);
+	PendingAxisInputs.Reset();
+
+	for (const FVMPendingAxisInput& Pending : ToDispatch)
+	{
+		DispatchToPlayer(Pending.LocalPlayerIndex, Pending.Args);
+	}
+
+	AxisDispatchesThisFrame += ToDispatch.Num();
+	InputCoalescingStats.TotalDispatchesOut += ToDispatch.Num();
+}
+
+void UVMGameViewportClient::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+	{
+		return;
+	}
+
+	FlushPendingAxisInput();
 
-	return Super::InputAxis(EventArgs);
+	// Key events may already have flushed part of this frame's input; the frame counters cover both
+	InputCoalescingStats.LastFrameEventsIn = AxisEventsThisFrame;
+	InputCoalescingStats.LastFrameDispatchesOut = AxisDispatchesThisFrame;
+	AxisEventsThisFrame = 0;
+	AxisDispatchesThisFrame = 0;
 }
 
 void UVMGameViewportClient::ApplyLayout(UVMSplitLayoutAsset* LayoutAsset)
 {
+	VM_SCOPE_CYCLE_COUNTER(STAT_VM_ApplyLayout);
+	LLM_SCOPE_BYTAG(ViewportManager_Layout);
+
 	if (!LayoutAsset)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMGameViewportClient::ApplyLayout - LayoutAsset is null"));
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMGameViewportClient::ApplyLayout - LayoutAsset is null"));
 		return;
 	}
 
-	CurrentLayoutAsset = LayoutAsset;
-	PlayerRects.Empty();
+	if (const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>())
+	{
+		if (Settings->bUseStagedLayoutApply && !CanApplyIncrementally(*LayoutAsset))
+		{
+			ApplyLayoutStaged(LayoutAsset, Settings->StagedApplyFrameBudgetMs);
+			return;
+		}
+	}
 
-	TSet<int32> UsedIndices;
+	CancelStagedApply();
+	StopLayoutTransition();
 
-	for (const FVMSplitPane& Pane : LayoutAsset->Panes)
+	LastApplyStats = FVMLayoutApplyStats();
+	LastApplyStats.bIncremental = CanApplyIncrementally(*LayoutAsset);
+
+	const bool bRebuildRendering = !LastApplyStats.bIncremental || NeedsPaneRenderingRebuild(*LayoutAsset);
+	const int32 ProcessedPanes = RebuildPlayerRects(LayoutAsset);
+
+	if (LastApplyStats.bIncremental)
+	{
+		ApplyLayoutDelta();
+	}
+	else
+	{
+		CancelDeferredPaneClassLoads();
+		EnsureLocalPlayersExist();
+		SpawnAndPossessPawns();
+		EnsureCursorVisibility();
+		SetupViewportHUDs();
+	}
+
+	if (bRebuildRendering)
+	{
+		RebuildPaneRendering();
+	}
+	else
+	{
+		// Rect drags reach here every frame; keep the captures, profiles and update schedule
+		UpdatePaneResolution();
+		if (LastApplyStats.PawnsSpawned > 0 || LastApplyStats.PawnsReused > 0)
+		{
+			ApplyPaneTickThrottling();
+		}
+	}
+
+	AppliedPanes = LayoutAsset->Panes;
+	AppliedWorld = GetWorld();
+	RefreshLayout();
+
+	UE_LOG(LogVMLayout, Verbose, TEXT("UVMGameViewportClient::ApplyLayout - Applied layout with %d panes (%s, %d objects touched)"),
+		ProcessedPanes, LastApplyStats.bIncremental ? TEXT("incremental") : TEXT("full"), LastApplyStats.GetTotalTouched());
+
+	OnLayoutApplyComplete.Broadcast(LayoutAsset);
+}
+
+void UVMGameViewportClient::TransitionToLayout(UVMSplitLayoutAsset* LayoutAsset, float Duration, UCurveFloat* Curve)
+{
+	LLM_SCOPE_BYTAG(ViewportManager_Layout);
+
+	if (!LayoutAsset)
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMGameViewportClient::TransitionToLayout - LayoutAsset is null"));
+		return;
+	}
+
+	// Start from what is on screen, which may be the middle of a previous transition
+	TMap<int32, FVMSplitRect> FromRects;
+	if (UGameInstance* LocalGameInstance = GetGameInstance())
+	{
+		for (const auto& PlayerRectPair : PlayerRects)
+		{
+			const ULocalPlayer* LocalPlayer = LocalGameInstance->GetLocalPlayerByIndex(PlayerRectPair.Key);
+			if (LocalPlayer && LocalPlayer->Size.X > 0.0 && LocalPlayer->Size.Y > 0.0)
+			{
+				FVMSplitRect& FromRect = FromRects.Add(PlayerRectPair.Key);
+				FromRect.Origin01 = FVector2f(LocalPlayer->Origin);
+				FromRect.Size01 = FVector2f(LocalPlayer->Size);
+			}
+		}
+	}
+
+	// Players, pawns and HUDs are set up once here; only rects and anchors change while animating
+	ApplyLayout(LayoutAsset);
+
+	if (Duration <= 0.0f || CurrentLayoutAsset != LayoutAsset || PlayerRects.Num() == 0)
+	{
+		return;
+	}
+
+	// Panes that were not visible grow out of their own center
+	for (const auto& PlayerRectPair : PlayerRects)
+	{
+		if (!FromRects.Contains(PlayerRectPair.Key))
+		{
+			FVMSplitRect& FromRect = FromRects.Add(PlayerRectPair.Key);
+			FromRect.Origin01 = PlayerRectPair.Value.Origin01 + PlayerRectPair.Value.Size01 * 0.5f;
+			FromRect.Size01 = FVector2f::ZeroVector;
+		}
+	}
+
+	TransitionFromRects = MoveTemp(FromRects);
+	TransitionStartTime = FPlatformTime::Seconds();
+	TransitionDuration = Duration;
+	TransitionCurve = Curve;
+
+	RefreshLayout();
+
+	UE_LOG(LogVMLayout, Verbose, TEXT("UVMGameViewportClient::TransitionToLayout - Animating %d panes over %.2fs"), PlayerRects.Num(), Duration);
+}
+
+void UVMGameViewportClient::StopLayoutTransition()
+{
+	TransitionFromRects.Reset();
+	TransitionDuration = 0.0;
+	TransitionCurve = nullptr;
+}
+
+int32 UVMGameViewportClient::RebuildPlayerRects(UVMSplitLayoutAsset* LayoutAsset)
+{
+	CurrentLayoutAsset = LayoutAsset;
+	PlayerRects.Empty();
+
+	TSet<int32> UsedIndices;
+
+	for (const FVMSplitPane& Pane : LayoutAsset->Panes)
+	{
+		// UI-only panes do not need a local player or 3D viewport - just the HUD
+		if (Pane.bUIOnly)
+		{
+			UE_LOG(LogVMLayout, Verbose, TEXT("UVMGameViewportClient::ApplyLayout - Pane %d is UI-only, skipping player setup"), Pane.LocalPlayerIndex);
+			continue;
+		}
+
+		// View-only panes render through a scene capture, mirror panes reuse another pane's image
+		if (Pane.bViewOnly || Pane.bMirror)
+		{
+			continue;
+		}
+
+		if (Pane.LocalPlayerIndex < 0)
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("UVMGameViewportClient::ApplyLayout - Invalid LocalPlayerIndex %d"), Pane.LocalPlayerIndex);
+			continue;
+		}
+
+		if (UsedIndices.Contains(Pane.LocalPlayerIndex))
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("UVMGameViewportClient::ApplyLayout - Duplicate LocalPlayerIndex %d"), Pane.LocalPlayerIndex);
+			continue;
+		}
+
+		UsedIndices.Add(Pane.LocalPlayerIndex);
+		PlayerRects.Add(Pane.LocalPlayerIndex, Pane.Rect);
+	}
+
+	CompiledLayout.Compile(*LayoutAsset);
+	InputRouting.Rebuild(*LayoutAsset, CompiledLayout);
+
+	const int32 ProcessedPanes = PlayerRects.Num();
+
+	if (!PlayerRects.Contains(ActiveKeyboardMouseLP))
+	{
+		if (PlayerRects.Num() > 0)
+		{
+			ActiveKeyboardMouseLP = PlayerRects.CreateConstIterator()->Key;
+		}
+		else
+		{
+			ActiveKeyboardMouseLP = 0;
+		}
+	}
+
+	return ProcessedPanes;
+}
+
+void UVMGameViewportClient::ApplyLayoutStaged(UVMSplitLayoutAsset* LayoutAsset, float FrameBudgetMs)
+{
+	LLM_SCOPE_BYTAG(ViewportManager_Layout);
+
+	if (!LayoutAsset)
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMGameViewportClient::ApplyLayoutStaged - LayoutAsset is null"));
+		return;
+	}
+
+	CancelStagedApply();
+	CancelDeferredPaneClassLoads();
+	StopLayoutTransition();
+
+	LastApplyStats = FVMLayoutApplyStats();
+	LastApplyStats.bStaged = true;
+	StagedApplyBudgetSeconds = FMath::Max(FrameBudgetMs, 0.1f) / 1000.0f;
+
+	RebuildPlayerRects(LayoutAsset);
+
+	ClearPaneHUDs();
+	if (AppliedWorld.Get() != GetWorld())
+	{
+		HUDPool.Reset();
+	}
+
+	// Steps for one pane are contiguous so each pane comes online fully before the next one starts
+	for (int32 PaneIndex = 0; PaneIndex < LayoutAsset->Panes.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = LayoutAsset->Panes[PaneIndex];
+		if (Pane.NeedsLocalPlayer())
+		{
+			const int32 Slot = CompiledLayout.FindSlotForPlayer(Pane.LocalPlayerIndex);
+			if (Slot == INDEX_NONE || CompiledLayout.GetPaneIndex(Slot) != PaneIndex)
+			{
+				continue;
+			}
+
+			StagedApplySteps.Add({ EVMStagedApplyStep::CreatePlayer, PaneIndex });
+			StagedApplySteps.Add({ EVMStagedApplyStep::SpawnPawn, PaneIndex });
+		}
+
+		if (!Pane.GetViewportHUDClassRef().IsNull())
+		{
+			StagedApplySteps.Add({ EVMStagedApplyStep::CreateHUD, PaneIndex });
+		}
+	}
+
+	// Scene captures are cheap to create, so view panes come online immediately
+	RebuildPaneRendering();
+
+	// Invalidate the snapshot so edits made while staging take the full path
+	AppliedPanes.Reset();
+	RefreshLayout();
+
+	UE_LOG(LogVMLayout, Log, TEXT("UVMGameViewportClient::ApplyLayoutStaged - Queued %d steps with a %.2fms frame budget"),
+		StagedApplySteps.Num(), StagedApplyBudgetSeconds * 1000.0f);
+
+	if (StagedApplySteps.Num() == 0)
+	{
+		FinishStagedApply();
+	}
+}
+
+bool UVMGameViewportClient::IsStagedApplyPending() const
+{
+	return StagedApplySteps.IsValidIndex(NextStagedApplyStep);
+}
+
+void UVMGameViewportClient::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (IsStagedApplyPending())
+	{
+		ProcessStagedApply();
+	}
+
+	UpdatePaneSchedule();
+
+#if VM_WITH_PANE_COSTS
+	SyncControllerTickTimers();
+#endif
+
+	if (CurrentLayoutAsset && ViewPanes.Num() > 0)
+	{
+		ViewPanes.UpdateCameras(*CurrentLayoutAsset, PanesDueThisFrame);
+	}
+
+#if STATS
+	UpdateStatCounters();
+#endif
+
+#if VM_WITH_PANE_COSTS
+	// Everything since the previous viewport tick: last frame's HUD tick and paint, this frame's input and world tick
+	FVMPaneCosts::EndFrame();
+#endif
+}
+
+#if STATS
+void UVMGameViewportClient::UpdateStatCounters() const
+{
+	if (!FThreadStats::IsCollectingData())
+	{
+		return;
+	}
+
+	int32 LiveHUDs = 0;
+	for (const TPair<int32, TWeakObjectPtr<UUserWidget>>& Entry : ActivePaneHUDs)
+	{
+		LiveHUDs += Entry.Value.IsValid() ? 1 : 0;
+	}
+
+	int32 PanePawns = 0;
+	if (const UGameInstance* LocalGameInstance = GetGameInstance())
+	{
+		for (int32 Slot = 0; Slot < CompiledLayout.Num(); ++Slot)
+		{
+			const ULocalPlayer* LocalPlayer = LocalGameInstance->GetLocalPlayerByIndex(CompiledLayout.GetLocalPlayerIndex(Slot));
+			const APlayerController* PC = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+			PanePawns += PC && PC->GetPawn() ? 1 : 0;
+		}
+	}
+
+	SET_DWORD_STAT(STAT_VM_Panes, CurrentLayoutAsset ? CurrentLayoutAsset->Panes.Num() : 0);
+	SET_DWORD_STAT(STAT_VM_DormantPanes, DormantPanes.Num());
+	SET_DWORD_STAT(STAT_VM_LiveHUDs, LiveHUDs);
+	SET_DWORD_STAT(STAT_VM_PanePawns, PanePawns);
+}
+#endif
+
+int64 UVMGameViewportClient::EstimateObjectBytes(const UObject* Object)
+{
+	if (!Object)
+	{
+		return 0;
+	}
+
+	TArray<UObject*> Objects;
+	GetObjectsWithOuter(Object, Objects, true);
+	Objects.Add(const_cast<UObject*>(Object));
+
+	int64 Bytes = 0;
+	for (UObject* Each : Objects)
+	{
+		FArchiveCountMem Count(Each);
+		Bytes += Each->GetClass()->GetStructureSize() + Count.GetMax();
+	}
+	return Bytes;
+}
+
+APawn* UVMGameViewportClient::GetPanePawn(int32 LocalPlayerIndex) const
+{
+	const UGameInstance* LocalGameInstance = GetGameInstance();
+	const ULocalPlayer* LocalPlayer = LocalGameInstance ? LocalGameInstance->GetLocalPlayerByIndex(LocalPlayerIndex) : nullptr;
+	const APlayerController* PC = LocalPlayer ? LocalPlayer->GetPlayerController(GetWorld()) : nullptr;
+	return PC ? PC->GetPawn() : nullptr;
+}
+
+TArray<FVMPaneMemoryStats> UVMGameViewportClient::GetPaneMemoryStats() const
+{
+	TArray<FVMPaneMemoryStats> Result;
+	if (!CurrentLayoutAsset)
+	{
+		return Result;
+	}
+
+	for (int32 PaneIndex = 0; PaneIndex < CurrentLayoutAsset->Panes.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+
+		FVMPaneMemoryStats& Stats = Result.AddDefaulted_GetRef();
+		Stats.PaneIndex = PaneIndex;
+		Stats.LocalPlayerIndex = Pane.LocalPlayerIndex;
+		Stats.bDormant = DormantPanes.Contains(Pane.LocalPlayerIndex);
+
+		if (!Pane.bUIOnly && !Pane.bViewOnly && !Pane.bMirror)
+		{
+			const APawn* Pawn = GetPanePawn(Pane.LocalPlayerIndex);
+			Stats.bHasPawn = Pawn != nullptr;
+			Stats.PawnBytes = EstimateObjectBytes(Pawn);
+		}
+
+		const TWeakObjectPtr<UUserWidget>* HUD = ActivePaneHUDs.Find(Pane.LocalPlayerIndex);
+		if (HUD && HUD->IsValid())
+		{
+			Stats.bHasHUD = true;
+			Stats.HUDBytes = EstimateObjectBytes(HUD->Get());
+		}
+	}
+	return Result;
+}
+
+FVMMemoryStats UVMGameViewportClient::GetMemoryStats() const
+{
+	FVMMemoryStats Stats;
+	Stats.LayoutBytes = EstimateObjectBytes(CurrentLayoutAsset) + AppliedPanes.GetAllocatedSize() + PlayerRects.GetAllocatedSize()
+		+ TransitionFromRects.GetAllocatedSize() + StagedApplySteps.GetAllocatedSize();
+	Stats.HUDRootBytes = EstimateObjectBytes(HUDRootWidget);
+
+	TArray<UUserWidget*> IdleWidgets;
+	HUDPool.GetIdleWidgets(IdleWidgets);
+	Stats.IdleHUDs = IdleWidgets.Num();
+	for (const UUserWidget* Widget : IdleWidgets)
+	{
+		Stats.IdleHUDBytes += EstimateObjectBytes(Widget);
+	}
+
+	TArray<APawn*> IdlePawns;
+	PawnPool.GetIdlePawns(IdlePawns);
+	Stats.IdlePawns = IdlePawns.Num();
+	for (const APawn* Pawn : IdlePawns)
+	{
+		Stats.IdlePawnBytes += EstimateObjectBytes(Pawn);
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return Stats;
+	}
+
+	// Everything a pane or pool accounts for; anything else of a pane class is untracked
+	TSet<const UObject*> Tracked;
+	for (const UUserWidget* Widget : IdleWidgets)
+	{
+		Tracked.Add(Widget);
+	}
+	for (const APawn* Pawn : IdlePawns)
+	{
+		Tracked.Add(Pawn);
+	}
+	TSet<const UClass*> HUDClasses = { UVMViewportHUDWidget::StaticClass() };
+	TSet<const UClass*> PawnClasses = { AVMCameraPawn::StaticClass(), AVMFreeCameraPawn::StaticClass() };
+
+	for (const TPair<int32, TWeakObjectPtr<UUserWidget>>& Entry : ActivePaneHUDs)
+	{
+		Tracked.Add(Entry.Value.Get());
+	}
+	for (const TPair<int32, FVMDormantPane>& Entry : DormantPanes)
+	{
+		Tracked.Add(Entry.Value.Pawn.Get());
+		Tracked.Add(Entry.Value.HUD.Get());
+	}
+	if (CurrentLayoutAsset)
+	{
+		for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
+		{
+			Tracked.Add(GetPanePawn(Pane.LocalPlayerIndex));
+
+			// Only classes already in memory can have instances
+			if (const UClass* HUDClass = Pane.GetViewportHUDClassRef().Get())
+			{
+				HUDClasses.Add(HUDClass);
+			}
+			if (const UClass* PawnClass = ResolvePawnClassRef(Pane).Get())
+			{
+				PawnClasses.Add(PawnClass);
+			}
+		}
+	}
+
+	auto IsOfAny = [](const UObject* Object, const TSet<const UClass*>& Classes)
+	{
+		for (const UClass* Class : Classes)
+		{
+			if (Object->IsA(Class))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	for (TObjectIterator<UUserWidget> It; It; ++It)
+	{
+		const UUserWidget* Widget = *It;
+
+		// Widgets inside another widget's tree belong to that widget
+		if (!IsValid(Widget) || Widget->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject) || Widget->GetWorld() != World
+			|| Widget->GetOuter()->IsA<UWidgetTree>() || Tracked.Contains(Widget) || !IsOfAny(Widget, HUDClasses))
+		{
+			continue;
+		}
+
+		++Stats.UntrackedHUDs;
+		Stats.UntrackedHUDBytes += EstimateObjectBytes(Widget);
+	}
+
+	for (TActorIterator<APawn> It(World); It; ++It)
+	{
+		const APawn* Pawn = *It;
+		if (!IsValid(Pawn) || Tracked.Contains(Pawn) || !IsOfAny(Pawn, PawnClasses))
+		{
+			continue;
+		}
+
+		++Stats.UntrackedPawns;
+		Stats.UntrackedPawnBytes += EstimateObjectBytes(Pawn);
+	}
+
+	return Stats;
+}
+
+void UVMGameViewportClient::RebuildPaneRendering()
+{
+	if (!CurrentLayoutAsset)
+	{
+		ViewPanes.Reset();
+		MirrorPanes.Reset();
+		bHasRenderProfiles = false;
+		SharedRenderShowFlags.Reset();
+		ResetPaneUpdateSchedule();
+		RenderedLayout.Reset();
+		return;
+	}
+
+	const FIntPoint ViewportSize = Viewport ? Viewport->GetSizeXY() : FIntPoint(1920, 1080);
+	FVMPaneResolution::ComputeScales(CurrentLayoutAsset->Panes, ViewportSize, PaneResolutionScales);
+	ApplyPaneResolutionScales();
+	ApplyPaneRenderProfiles();
+
+	ViewPanes.Rebuild(*CurrentLayoutAsset, GetWorld(), ViewportSize, PaneResolutionScales);
+	MirrorPanes.Rebuild(*CurrentLayoutAsset);
+
+	ResetPaneUpdateSchedule();
+	ApplyPaneTickThrottling();
+
+	RenderedLayout = CurrentLayoutAsset.Get();
+	RenderedViewportSize = ViewportSize;
+}
+
+bool UVMGameViewportClient::NeedsPaneRenderingRebuild(const UVMSplitLayoutAsset& LayoutAsset) const
+{
+	const FIntPoint ViewportSize = Viewport ? Viewport->GetSizeXY() : FIntPoint(1920, 1080);
+	if (RenderedLayout.Get() != &LayoutAsset || RenderedViewportSize != ViewportSize || AppliedPanes.Num() != LayoutAsset.Panes.Num())
+	{
+		return true;
+	}
+
+	for (int32 PaneIndex = 0; PaneIndex < AppliedPanes.Num(); ++PaneIndex)
+	{
+		if (HasRenderSettingsChanged(LayoutAsset.Panes[PaneIndex], AppliedPanes[PaneIndex]))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UVMGameViewportClient::UpdatePaneResolution()
+{
+	if (!CurrentLayoutAsset)
+	{
+		return;
+	}
+
+	// Area-based policies depend on the rects, so the scales still follow a drag
+	const FIntPoint ViewportSize = Viewport ? Viewport->GetSizeXY() : FIntPoint(1920, 1080);
+	FVMPaneResolution::ComputeScales(CurrentLayoutAsset->Panes, ViewportSize, PaneResolutionScales);
+	ApplyPaneResolutionScales();
+	ViewPanes.UpdateResolution(*CurrentLayoutAsset, ViewportSize, PaneResolutionScales);
+}
+
+void UVMGameViewportClient::ResetPaneUpdateSchedule()
+{
+	PaneUpdateDivisors.Reset();
+	PaneUpdateStats.Reset();
+	PanesDueThisFrame.Reset();
+	PaneUpdateWindowStart = FPlatformTime::Seconds();
+	PaneUpdateWindowFrames = 0;
+
+	if (!CurrentLayoutAsset)
+	{
+		return;
+	}
+
+	for (int32 PaneIndex = 0; PaneIndex < CurrentLayoutAsset->Panes.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+		PaneUpdateDivisors.Add(FMath::Max(Pane.UpdateDivisor, 1));
+
+		FVMPaneUpdateStats& Stats = PaneUpdateStats.AddDefaulted_GetRef();
+		Stats.PaneIndex = PaneIndex;
+		Stats.LocalPlayerIndex = Pane.LocalPlayerIndex;
+	}
+
+	PanesDueThisFrame.Init(true, PaneUpdateDivisors.Num());
+}
+
+void UVMGameViewportClient::UpdatePaneSchedule()
+{
+	if (PaneUpdateStats.Num() == 0)
+	{
+		return;
+	}
+
+	++PaneUpdateFrame;
+	++PaneUpdateWindowFrames;
+
+	for (int32 PaneIndex = 0; PaneIndex < PaneUpdateStats.Num(); ++PaneIndex)
+	{
+		const int32 Divisor = GetEffectiveUpdateDivisor(PaneIndex);
+
+		// Offset by pane index so throttled panes spread over frames instead of all updating together
+		const bool bDue = Divisor <= 1 || (PaneUpdateFrame + PaneIndex) % Divisor == 0;
+		PanesDueThisFrame[PaneIndex] = bDue;
+
+		FVMPaneUpdateStats& Stats = PaneUpdateStats[PaneIndex];
+		Stats.UpdateDivisor = Divisor;
+		if (bDue)
+		{
+			++Stats.TotalUpdates;
+			++Stats.UpdatesInWindow;
+		}
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double WindowSeconds = Now - PaneUpdateWindowStart;
+	if (WindowSeconds < 1.0)
+	{
+		return;
+	}
+
+	for (FVMPaneUpdateStats& Stats : PaneUpdateStats)
+	{
+		Stats.UpdatesPerSecond = static_cast<float>(Stats.UpdatesInWindow / WindowSeconds);
+		Stats.UpdatesInWindow = 0;
+	}
+
+	ThrottleFrameTime = static_cast<float>(WindowSeconds / PaneUpdateWindowFrames);
+	PaneUpdateWindowStart = Now;
+	PaneUpdateWindowFrames = 0;
+
+	// Picks up frame rate changes and pawns that were respawned since the last window
+	ApplyPaneTickThrottling();
+}
+
+int32 UVMGameViewportClient::GetEffectiveUpdateDivisor(int32 PaneIndex) const
+{
+	if (!PaneUpdateDivisors.IsValidIndex(PaneIndex) || !CurrentLayoutAsset || !CurrentLayoutAsset->Panes.IsValidIndex(PaneIndex))
+	{
+		return 1;
+	}
+
+	const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+	if (Pane.NeedsLocalPlayer() && Pane.LocalPlayerIndex == FocusedPlayerIndex)
+	{
+		return 1;
+	}
+
+	return PaneUpdateDivisors[PaneIndex];
+}
+
+void UVMGameViewportClient::SetPaneUpdateDivisor(int32 LocalPlayerIndex, int32 UpdateDivisor)
+{
+	if (!CurrentLayoutAsset)
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMGameViewportClient::SetPaneUpdateDivisor - No current layout"));
+		return;
+	}
+
+	bool bFound = false;
+	for (int32 PaneIndex = 0; PaneIndex < PaneUpdateDivisors.Num(); ++PaneIndex)
+	{
+		if (CurrentLayoutAsset->Panes[PaneIndex].LocalPlayerIndex == LocalPlayerIndex)
+		{
+			PaneUpdateDivisors[PaneIndex] = FMath::Clamp(UpdateDivisor, 1, 16);
+			bFound = true;
+		}
+	}
+
+	if (!bFound)
+	{
+		VM_LOG_RATE_LIMITED(LogVMLayout, Warning, 1.0, TEXT("UVMGameViewportClient::SetPaneUpdateDivisor - No pane shows LocalPlayerIndex %d"), LocalPlayerIndex);
+		return;
+	}
+
+	ApplyPaneTickThrottling();
+}
+
+int32 UVMGameViewportClient::GetPaneUpdateDivisor(int32 LocalPlayerIndex) const
+{
+	if (CurrentLayoutAsset)
+	{
+		for (int32 PaneIndex = 0; PaneIndex < PaneUpdateDivisors.Num(); ++PaneIndex)
+		{
+			if (CurrentLayoutAsset->Panes[PaneIndex].LocalPlayerIndex == LocalPlayerIndex)
+			{
+				return PaneUpdateDivisors[PaneIndex];
+			}
+		}
+	}
+
+	return 1;
+}
+
+void UVMGameViewportClient::ApplyPaneTickThrottling()
+{
+	UGameInstance* LocalGameInstance = GetGameInstance();
+	if (!CurrentLayoutAsset || !LocalGameInstance)
+	{
+		return;
+	}
+
+	for (int32 PaneIndex = 0; PaneIndex < PaneUpdateDivisors.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+		const int32 Divisor = GetEffectiveUpdateDivisor(PaneIndex);
+
+		const TWeakObjectPtr<UUserWidget>* HUD = ActivePaneHUDs.Find(Pane.LocalPlayerIndex);
+		if (UVMViewportHUDWidget* VMHUD = HUD ? Cast<UVMViewportHUDWidget>(HUD->Get()) : nullptr)
+		{
+			VMHUD->SetUpdateDivisor(Divisor);
+		}
+
+		// Only the pane that owns the player in the compiled layout drives its actors
+		const int32 Slot = CompiledLayout.FindSlotForPlayer(Pane.LocalPlayerIndex);
+		if (Slot == INDEX_NONE || CompiledLayout.GetPaneIndex(Slot) != PaneIndex)
+		{
+			continue;
+		}
+
+		ULocalPlayer* LP = LocalGameInstance->GetLocalPlayerByIndex(Pane.LocalPlayerIndex);
+		APlayerController* PC = LP ? LP->GetPlayerController(GetWorld()) : nullptr;
+		if (!PC)
+		{
+			continue;
+		}
+
+		ThrottleActorTicks(PC, Divisor);
+		ThrottleActorTicks(PC->GetPawn(), Divisor);
+	}
+}
+
+void UVMGameViewportClient::ThrottleActorTicks(AActor* Actor, int32 UpdateDivisor) const
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	// Interval ticks receive the time since their last tick, so throttled actors still integrate the full frame time.
+	// Half a frame of slack keeps the interval from slipping a whole frame on jitter.
+	const float ThrottledInterval = UpdateDivisor > 1 ? (UpdateDivisor - 0.5f) * ThrottleFrameTime : -1.0f;
+
+	const AActor* Archetype = CastChecked<AActor>(Actor->GetArchetype());
+	const float ActorInterval = ThrottledInterval >= 0.0f ? ThrottledInterval : Archetype->PrimaryActorTick.TickInterval;
+	if (!FMath::IsNearlyEqual(Actor->GetActorTickInterval(), ActorInterval))
+	{
+		Actor->SetActorTickInterval(ActorInterval);
+	}
+
+	Actor->ForEachComponent(false, [ThrottledInterval](UActorComponent* Component)
+	{
+		const UActorComponent* ComponentArchetype = Cast<UActorComponent>(Component->GetArchetype());
+		const float ComponentInterval = ThrottledInterval >= 0.0f ? ThrottledInterval
+			: (ComponentArchetype ? ComponentArchetype->PrimaryComponentTick.TickInterval : 0.0f);
+		if (!FMath::IsNearlyEqual(Component->GetComponentTickInterval(), ComponentInterval))
+		{
+			Component->SetComponentTickInterval(ComponentInterval);
+		}
+	});
+}
+
+void UVMGameViewportClient::ApplyPaneRenderProfiles()
+{
+	TArray<const UVMPaneRenderProfile*, TInlineAllocator<8>> PlayerProfiles;
+	bHasRenderProfiles = false;
+
+	for (int32 Slot = 0; Slot < CompiledLayout.Num(); ++Slot)
+	{
+		const UVMPaneRenderProfile* Profile = CurrentLayoutAsset->Panes[CompiledLayout.GetPaneIndex(Slot)].RenderProfile;
+		PlayerProfiles.Add(Profile);
+		bHasRenderProfiles |= Profile != nullptr;
+	}
+
+	SharedRenderShowFlags = UVMPaneRenderProfile::GetSharedShowFlagOverrides(PlayerProfiles);
+
+	if (bHasRenderProfiles && !PaneViewExtension.IsValid())
+	{
+		PaneViewExtension = FSceneViewExtensions::NewExtension<FVMPaneSceneViewExtension>(this);
+	}
+}
+
+const UVMPaneRenderProfile* UVMGameViewportClient::FindRenderProfileForController(int32 ControllerId) const
+{
+	const UGameInstance* LocalGameInstance = GetGameInstance();
+	if (!bHasRenderProfiles || !LocalGameInstance)
+	{
+		return nullptr;
+	}
+
+	const TArray<ULocalPlayer*>& LocalPlayers = LocalGameInstance->GetLocalPlayers();
+	for (int32 LocalPlayerIndex = 0; LocalPlayerIndex < LocalPlayers.Num(); ++LocalPlayerIndex)
+	{
+		if (LocalPlayers[LocalPlayerIndex] && LocalPlayers[LocalPlayerIndex]->GetControllerId() == ControllerId)
+		{
+			const FVMSplitPane* Pane = FindPaneForPlayer(LocalPlayerIndex);
+			return Pane ? Pane->RenderProfile.Get() : nullptr;
+		}
+	}
+
+	return nullptr;
+}
+
+void UVMGameViewportClient::ApplyPaneResolutionScales()
+{
+	static IConsoleVariable* CVarScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
+	if (!CVarScreenPercentage || !CurrentLayoutAsset)
+	{
+		return;
+	}
+
+	// Player panes share one view family and therefore one screen percentage, so the sharpest
+	// request wins; view-only panes get their own scale through their render target size
+	bool bAnyReduced = false;
+	float SharedScale = 0.0f;
+	for (int32 PaneIndex = 0; PaneIndex < CurrentLayoutAsset->Panes.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+		if (!Pane.NeedsLocalPlayer() || !PaneResolutionScales.IsValidIndex(PaneIndex))
+		{
+			continue;
+		}
+
+		SharedScale = FMath::Max(SharedScale, PaneResolutionScales[PaneIndex]);
+		bAnyReduced |= Pane.ResolutionPolicy != EVMPaneResolutionPolicy::Native;
+	}
+
+	if (bAnyReduced && SharedScale > 0.0f)
+	{
+		if (!bOverridingScreenPercentage)
+		{
+			SavedScreenPercentage = CVarScreenPercentage->GetFloat();
+			bOverridingScreenPercentage = true;
+		}
+
+		const float ScreenPercentage = SharedScale * SavedScreenPercentage;
+		if (!FMath::IsNearlyEqual(CVarScreenPercentage->GetFloat(), ScreenPercentage))
+		{
+			CVarScreenPercentage->Set(ScreenPercentage, ECVF_SetByCode);
+			UE_LOG(LogVMLayout, Verbose, TEXT("Player panes render at %.0f%% screen percentage"), ScreenPercentage);
+		}
+	}
+	else if (bOverridingScreenPercentage)
+	{
+		CVarScreenPercentage->Set(SavedScreenPercentage, ECVF_SetByCode);
+		bOverridingScreenPercentage = false;
+	}
+}
+
+void UVMGameViewportClient::ProcessStagedApply()
+{
+	LLM_SCOPE_BYTAG(ViewportManager_Layout);
+
+	if (!CurrentLayoutAsset || !GetWorld())
+	{
+		CancelStagedApply();
+		return;
+	}
+
+	// Always make progress, even when a single step exceeds the budget
+	const double Deadline = FPlatformTime::Seconds() + StagedApplyBudgetSeconds;
+	do
+	{
+		const FVMStagedApplyEntry Entry = StagedApplySteps[NextStagedApplyStep++];
+		if (!CurrentLayoutAsset->Panes.IsValidIndex(Entry.PaneIndex))
+		{
+			continue;
+		}
+
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[Entry.PaneIndex];
+		switch (Entry.Step)
+		{
+		case EVMStagedApplyStep::CreatePlayer:
+			EnsureLocalPlayerExists(Pane.LocalPlayerIndex);
+			RefreshLayout();
+			break;
+		case EVMStagedApplyStep::SpawnPawn:
+			SpawnAndPossessPawnForPane(Pane);
+			ApplyCursorVisibility(Pane.LocalPlayerIndex);
+			break;
+		case EVMStagedApplyStep::CreateHUD:
+			CreatePaneHUD(Pane);
+			break;
+		}
+	}
+	while (IsStagedApplyPending() && FPlatformTime::Seconds() < Deadline);
+
+	++LastApplyStats.StagedFrames;
+
+	if (!IsStagedApplyPending())
+	{
+		FinishStagedApply();
+	}
+}
+
+void UVMGameViewportClient::FinishStagedApply()
+{
+	StagedApplySteps.Reset();
+	NextStagedApplyStep = 0;
+
+	if (!CurrentLayoutAsset)
+	{
+		return;
+	}
+
+	AppliedPanes = CurrentLayoutAsset->Panes;
+	AppliedWorld = GetWorld();
+	RefreshLayout();
+
+	// Pawns and HUDs spawned by the staged steps did not exist when the schedule was reset
+	ApplyPaneTickThrottling();
+
+	UE_LOG(LogVMLayout, Log, TEXT("UVMGameViewportClient::ApplyLayoutStaged - Completed over %d frames (%d objects touched)"),
+		LastApplyStats.StagedFrames, LastApplyStats.GetTotalTouched());
+
+	OnLayoutApplyComplete.Broadcast(CurrentLayoutAsset);
+}
+
+void UVMGameViewportClient::CancelStagedApply()
+{
+	if (IsStagedApplyPending())
+	{
+		UE_LOG(LogVMLayout, Log, TEXT("UVMGameViewportClient - Cancelled staged layout apply with %d steps remaining"),
+			StagedApplySteps.Num() - NextStagedApplyStep);
+	}
+
+	StagedApplySteps.Reset();
+	NextStagedApplyStep = 0;
+}
+
+void UVMGameViewportClient::PostRender(UCanvas* Canvas)
+{
+	Super::PostRender(Canvas);
+
+	if (Canvas && CurrentLayoutAsset && ViewPanes.Num() > 0)
+	{
+		ViewPanes.Draw(Canvas, *CurrentLayoutAsset);
+	}
+
+	if (Canvas && CurrentLayoutAsset && MirrorPanes.Num() > 0)
+	{
+		UGameInstance* LocalGameInstance = GetGameInstance();
+		MirrorPanes.Draw(Canvas, Viewport, *CurrentLayoutAsset, ViewPanes, [LocalGameInstance](int32 LocalPlayerIndex, FVMSplitRect& OutRect)
+		{
+			// The local player's current origin and size include any running layout transition
+			const ULocalPlayer* LP = LocalGameInstance ? LocalGameInstance->GetLocalPlayerByIndex(LocalPlayerIndex) : nullptr;
+			if (!LP || LP->Size.X <= 0.0f || LP->Size.Y <= 0.0f)
+			{
+				return false;
+			}
+
+			OutRect.Origin01 = FVector2f(LP->Origin);
+			OutRect.Size01 = FVector2f(LP->Size);
+			return true;
+		});
+	}
+
+#if VM_WITH_PANE_COSTS
+	if (Canvas && FVMPaneCosts::IsOverlayVisible())
+	{
+		DrawPaneCosts(Canvas);
+	}
+#endif
+
+	if (!Canvas || !CurrentLayoutAsset || (!IsStagedApplyPending() && DeferredPaneClassLoads.Num() == 0))
+	{
+		return;
+	}
+
+	// Cover panes that are still coming online so half-initialized views are never shown
+	int32 LastDrawnPane = INDEX_NONE;
+	for (int32 i = NextStagedApplyStep; i < StagedApplySteps.Num(); ++i)
+	{
+		const int32 PaneIndex = StagedApplySteps[i].PaneIndex;
+		if (PaneIndex == LastDrawnPane || !CurrentLayoutAsset->Panes.IsValidIndex(PaneIndex))
+		{
+			continue;
+		}
+		LastDrawnPane = PaneIndex;
+
+		DrawPanePlaceholder(Canvas, CurrentLayoutAsset->Panes[PaneIndex]);
+	}
+
+	for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
+	{
+		if (DeferredPaneClassLoads.Contains(Pane.LocalPlayerIndex))
+		{
+			DrawPanePlaceholder(Canvas, Pane);
+		}
+	}
+}
+
+void UVMGameViewportClient::DrawPanePlaceholder(UCanvas* Canvas, const FVMSplitPane& Pane) const
+{
+	const FVector2D CanvasSize(Canvas->ClipX, Canvas->ClipY);
+	const FVector2D Position(Pane.Rect.Origin01.X * CanvasSize.X, Pane.Rect.Origin01.Y * CanvasSize.Y);
+	const FVector2D Size(Pane.Rect.Size01.X * CanvasSize.X, Pane.Rect.Size01.Y * CanvasSize.Y);
+
+	if (!Pane.bUIOnly)
+	{
+		FCanvasTileItem Placeholder(Position, Size, FLinearColor(0.02f, 0.02f, 0.025f, 1.0f));
+		Placeholder.BlendMode = SE_BLEND_Opaque;
+		Canvas->DrawItem(Placeholder);
+	}
+
+	FCanvasTextItem Label(Position + FVector2D(8.0f, 8.0f),
+		FText::FromString(FString::Printf(TEXT("Loading pane %d..."), Pane.LocalPlayerIndex)),
+		GEngine->GetSmallFont(), FLinearColor(0.6f, 0.6f, 0.6f, 1.0f));
+	Canvas->DrawItem(Label);
+}
+
+#if VM_WITH_PANE_COSTS
+void UVMGameViewportClient::SyncControllerTickTimers()
+{
+	const UGameInstance* LocalGameInstance = GetGameInstance();
+	if (!FVMPaneCosts::IsEnabled() || !LocalGameInstance)
+	{
+		ControllerTickTimers.Reset();
+		return;
+	}
+
+	// Controllers change on travel and when local players come and go, so follow them every frame
+	const TArray<ULocalPlayer*>& LocalPlayers = LocalGameInstance->GetLocalPlayers();
+	for (auto It = ControllerTickTimers.CreateIterator(); It; ++It)
+	{
+		const ULocalPlayer* LP = LocalPlayers.IsValidIndex(It.Key()) ? LocalPlayers[It.Key()] : nullptr;
+		if (!LP || !It.Value()->GetController() || LP->GetPlayerController(GetWorld()) != It.Value()->GetController())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (int32 LocalPlayerIndex = 0; LocalPlayerIndex < LocalPlayers.Num(); ++LocalPlayerIndex)
+	{
+		APlayerController* PC = LocalPlayers[LocalPlayerIndex] ? LocalPlayers[LocalPlayerIndex]->GetPlayerController(GetWorld()) : nullptr;
+		if (PC && PC->GetLevel() && PC->PrimaryActorTick.IsTickFunctionRegistered() && !ControllerTickTimers.Contains(LocalPlayerIndex))
+		{
+			ControllerTickTimers.Add(LocalPlayerIndex, MakeUnique<FVMControllerTickTimer>(this, PC, LocalPlayerIndex));
+		}
+	}
+}
+
+void UVMGameViewportClient::DrawPaneCosts(UCanvas* Canvas) const
+{
+	const UGameInstance* LocalGameInstance = GetGameInstance();
+	if (!LocalGameInstance)
+	{
+		return;
+	}
+
+	const FVector2D CanvasSize(Canvas->ClipX, Canvas->ClipY);
+	for (int32 Slot = 0; Slot < CompiledLayout.Num(); ++Slot)
+	{
+		const int32 LocalPlayerIndex = CompiledLayout.GetLocalPlayerIndex(Slot);
+		const FVMPaneCosts::FPane* Costs = FVMPaneCosts::Find(LocalPlayerIndex);
+		const ULocalPlayer* LP = LocalGameInstance->GetLocalPlayerByIndex(LocalPlayerIndex);
+		if (!Costs || !LP || LP->Size.X <= 0.0f || LP->Size.Y <= 0.0f)
+		{
+			continue;
+		}
+
+		// Players of an earlier slot showing the same local player already drew its numbers
+		if (CompiledLayout.FindSlotForPlayer(LocalPlayerIndex) != Slot)
+		{
+			continue;
+		}
+
+		// The local player's origin follows running layout transitions
+		const FVector2D Position(LP->Origin.X * CanvasSize.X + 8.0f, (LP->Origin.Y + LP->Size.Y) * CanvasSize.Y - 40.0f);
+
+		FString Breakdown;
+		for (int32 Cost = 0; Cost < FVMPaneCosts::NumCosts; ++Cost)
+		{
+			Breakdown += FString::Printf(TEXT("%s%s %.2f"), Cost > 0 ? TEXT("  ") : TEXT(""),
+				FVMPaneCosts::GetCostName(static_cast<EVMPaneCost>(Cost)), Costs->AverageMs[Cost]);
+		}
+
+		FCanvasTextItem Total(Position,
+			FText::FromString(FString::Printf(TEXT("LP%d  %.2f ms (peak %.2f)"), LocalPlayerIndex, Costs->GetTotalMs(), Costs->PeakMs)),
+			GEngine->GetSmallFont(), FLinearColor::Yellow);
+		Total.EnableShadow(FLinearColor::Black);
+		Canvas->DrawItem(Total);
+
+		FCanvasTextItem Details(Position + FVector2D(0.0f, 16.0f), FText::FromString(Breakdown), GEngine->GetSmallFont(), FLinearColor::White);
+		Details.EnableShadow(FLinearColor::Black);
+		Canvas->DrawItem(Details);
+	}
+}
+#endif
+
+bool UVMGameViewportClient::CanApplyIncrementally(const UVMSplitLayoutAsset& LayoutAsset) const
+{
+	// Pawns and HUDs from a previous world are gone after travel, so the snapshot only holds within one world
+	if (!CurrentLayoutAsset || AppliedWorld.Get() != GetWorld() || AppliedPanes.Num() != LayoutAsset.Panes.Num())
+	{
+		return false;
+	}
+
+	// Pane identity must be unchanged; adding, removing or reordering panes falls back to a full apply
+	for (int32 i = 0; i < AppliedPanes.Num(); ++i)
+	{
+		const FVMSplitPane& Previous = AppliedPanes[i];
+		const FVMSplitPane& Pane = LayoutAsset.Panes[i];
+		if (Previous.LocalPlayerIndex != Pane.LocalPlayerIndex || Previous.bUIOnly != Pane.bUIOnly || Previous.bViewOnly != Pane.bViewOnly
+			|| Previous.bMirror != Pane.bMirror)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UVMGameViewportClient::ApplyLayoutDelta()
+{
+	LLM_SCOPE_BYTAG(ViewportManager_Layout);
+
+	if (!CurrentLayoutAsset || !GetWorld())
+	{
+		return;
+	}
+
+	for (int32 PaneIndex = 0; PaneIndex < CurrentLayoutAsset->Panes.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+		const FVMSplitPane& Previous = AppliedPanes[PaneIndex];
+
+		// Skip panes ApplyLayout rejected (invalid or duplicate LocalPlayerIndex)
+		if (Pane.NeedsLocalPlayer())
+		{
+			const int32 Slot = CompiledLayout.FindSlotForPlayer(Pane.LocalPlayerIndex);
+			if (Slot == INDEX_NONE || CompiledLayout.GetPaneIndex(Slot) != PaneIndex)
+			{
+				continue;
+			}
+		}
+
+		const bool bRectChanged = Pane.Rect.Origin01 != Previous.Rect.Origin01 || Pane.Rect.Size01 != Previous.Rect.Size01;
+		const bool bHUDClassChanged = Pane.GetViewportHUDClassRef() != Previous.GetViewportHUDClassRef();
+
+		if (Pane.NeedsLocalPlayer() && HasPawnSettingsChanged(Pane, Previous))
+		{
+			SpawnAndPossessPawnForPane(Pane);
+			ApplyCursorVisibility(Pane.LocalPlayerIndex);
+		}
+
+		if (bHUDClassChanged)
+		{
+			RemovePaneHUD(Pane.LocalPlayerIndex);
+			CreatePaneHUD(Pane);
+		}
+		else if (bRectChanged)
+		{
+			UpdatePaneHUDRect(Pane.LocalPlayerIndex, Pane.Rect);
+		}
+
+		if (bRectChanged)
+		{
+			++LastApplyStats.RectsUpdated;
+		}
+	}
+}
+
+bool UVMGameViewportClient::HasPawnSettingsChanged(const FVMSplitPane& Pane, const FVMSplitPane& Previous)
+{
+	// Only what SpawnAndPossessPawnForPane and ConfigurePawnForPane read; other pane fields never touch the pawn
+	if (Pane.CameraMode != Previous.CameraMode || ResolvePawnClassRef(Pane) != ResolvePawnClassRef(Previous))
+	{
+		return true;
+	}
+
+	if (Pane.bUseCustomCameraTransform != Previous.bUseCustomCameraTransform
+		|| (Pane.bUseCustomCameraTransform && !Pane.CameraTransform.Equals(Previous.CameraTransform, 0.0)))
+	{
+		return true;
+	}
+
+	if (Pane.bUseCustomFocusPoint != Previous.bUseCustomFocusPoint || Pane.OrbitDistance != Previous.OrbitDistance
+		|| (Pane.bUseCustomFocusPoint && Pane.FocusPoint != Previous.FocusPoint))
+	{
+		return true;
+	}
+
+	return !FVMCameraControlSettings::StaticStruct()->CompareScriptStruct(&Pane.CameraControls, &Previous.CameraControls, PPF_None);
+}
+
+bool UVMGameViewportClient::HasRenderSettingsChanged(const FVMSplitPane& Pane, const FVMSplitPane& Previous)
+{
+	// Everything RebuildPaneRendering reads besides the rect, which UpdatePaneResolution handles on its own
+	if (Pane.ResolutionPolicy != Previous.ResolutionPolicy || Pane.ResolutionScale != Previous.ResolutionScale
+		|| Pane.MinResolutionScale != Previous.MinResolutionScale || Pane.RenderProfile != Previous.RenderProfile
+		|| Pane.UpdateDivisor != Previous.UpdateDivisor || Pane.MirrorSourcePlayerIndex != Previous.MirrorSourcePlayerIndex)
+	{
+		return true;
+	}
+
+	if (!Pane.bViewOnly)
+	{
+		return false;
+	}
+
+	// View panes place their capture from the camera fields when they have no target
+	return Pane.ViewTarget != Previous.ViewTarget || Pane.ViewFieldOfView != Previous.ViewFieldOfView
+		|| !Pane.CameraTransform.Equals(Previous.CameraTransform, 0.0) || Pane.bUseCustomFocusPoint != Previous.bUseCustomFocusPoint
+		|| Pane.FocusPoint != Previous.FocusPoint || Pane.OrbitDistance != Previous.OrbitDistance;
+}
+
+void UVMGameViewportClient::RefreshLayout()
+{
+	LayoutPlayers();
+}
+
+void UVMGameViewportClient::SetActiveLocalPlayer(int32 LocalPlayerIndex)
+{
+	if (LocalPlayerIndex >= 0 && PlayerRects.Contains(LocalPlayerIndex))
+	{
+		int32 OldPlayerIndex = FocusedPlayerIndex;
+		ActiveKeyboardMouseLP = LocalPlayerIndex;
+		FocusedPlayerIndex = LocalPlayerIndex;
+
+		if (OldPlayerIndex != FocusedPlayerIndex)
+		{
+			// The newly focused pane runs at full rate, the previous one drops back to its divisor
+			ApplyPaneTickThrottling();
+
+			OnFocusChanged.Broadcast(OldPlayerIndex, FocusedPlayerIndex);
+			UE_LOG(LogVMInput, Verbose, TEXT("Focus changed from player %d to player %d"), OldPlayerIndex, FocusedPlayerIndex);
+		}
+
+		UE_LOG(LogVMInput, Verbose, TEXT("UVMGameViewportClient::SetActiveLocalPlayer - Set active player to %d"), LocalPlayerIndex);
+	}
+	else
+	{
+		VM_LOG_RATE_LIMITED(LogVMInput, Warning, 1.0, TEXT("UVMGameViewportClient::SetActiveLocalPlayer - LocalPlayerIndex %d is not part of the current layout"), LocalPlayerIndex);
+	}
+}
+
+void UVMGameViewportClient::EnsureLocalPlayersExist()
+{
+	if (!GetGameInstance())
+	{
+		return;
+	}
+
+	for (auto& PlayerRectPair : PlayerRects)
+	{
+		EnsureLocalPlayerExists(PlayerRectPair.Key);
+	}
+}
+
+void UVMGameViewportClient::EnsureLocalPlayerExists(int32 LocalPlayerIndex)
+{
+	if (!GetGameInstance() || GetGameInstance()->GetLocalPlayerByIndex(LocalPlayerIndex))
+	{
+		return;
+	}
+
+	const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>();
+	const bool bAutoAddPlayers = Settings ? Settings->bAutoAddMissingLocalPlayers : true;
+
+	const bool bShouldCreatePlayer = bAutoAddPlayers || (CurrentLayoutAsset && CurrentLayoutAsset->bAutoSpawnPlayers);
+	if (!bShouldCreatePlayer)
+	{
+		UE_LOG(LogVMLayout, Verbose, TEXT("Missing LocalPlayer %d but auto-spawn is disabled."), LocalPlayerIndex);
+		return;
+	}
+
+	FString CreatePlayerError;
+	ULocalPlayer* NewLocalPlayer = GetGameInstance()->CreateLocalPlayer(LocalPlayerIndex, CreatePlayerError, true);
+	if (NewLocalPlayer)
+	{
+		++LastApplyStats.LocalPlayersCreated;
+		UE_LOG(LogVMLayout, Log, TEXT("Created LocalPlayer %d for layout."), LocalPlayerIndex);
+	}
+	else
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("Failed to create LocalPlayer %d."), LocalPlayerIndex);
+		if (!CreatePlayerError.IsEmpty())
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("CreateLocalPlayer error: %s"), *CreatePlayerError);
+		}
+	}
+}
+
+void UVMGameViewportClient::SpawnAndPossessPawns()
+{
+	VM_SCOPE_CYCLE_COUNTER(STAT_VM_SpawnAndPossessPawns);
+
+	if (!CurrentLayoutAsset || !GetWorld())
+	{
+		return;
+	}
+
+	for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
+	{
+		if (!PlayerRects.Contains(Pane.LocalPlayerIndex))
+		{
+			continue;
+		}
+
+		SpawnAndPossessPawnForPane(Pane);
+	}
+}
+
+void UVMGameViewportClient::SpawnAndPossessPawnForPane(const FVMSplitPane& Pane)
+{
+	LLM_SCOPE_BYTAG(ViewportManager_Pawns);
+
+	ULocalPlayer* LocalPlayer = GetGameInstance()->GetLocalPlayerByIndex(Pane.LocalPlayerIndex);
+	if (!LocalPlayer)
+	{
+		return;
+	}
+
+	APlayerController* PC = LocalPlayer->GetPlayerController(GetWorld());
+	if (!PC)
+	{
+		return;
+	}
+
+	const TSubclassOf<APawn> DesiredPawnClass = ResolvePawnClass(Pane);
+	if (!DesiredPawnClass)
+	{
+		if (Pane.ClassLoadPolicy == EVMPaneClassLoadPolicy::OnFirstVisibility && RequestDeferredPaneClasses(Pane))
+		{
+			return;
+		}
+
+		UE_LOG(LogVMLayout, Warning, TEXT("Pane %d has no valid pawn class; skipping spawn."), Pane.LocalPlayerIndex);
+		return;
+	}
+
+	APawn* ActivePawn = PC->GetPawn();
+	if (ActivePawn && ActivePawn->GetClass() != DesiredPawnClass.Get())
+	{
+		PC->UnPossess();
+		if (PawnPool.Park(ActivePawn, GetMaxPooledPawnsPerClass()))
+		{
+			++LastApplyStats.PawnsParked;
+			UE_LOG(LogVMLayout, Verbose, TEXT("Parked mismatched pawn for LocalPlayer %d (expected %s)."),
+				Pane.LocalPlayerIndex, *DesiredPawnClass->GetName());
+		}
+		else
+		{
+			ActivePawn->Destroy();
+			++LastApplyStats.PawnsDestroyed;
+			UE_LOG(LogVMLayout, Verbose, TEXT("Destroyed mismatched pawn for LocalPlayer %d (expected %s)."),
+				Pane.LocalPlayerIndex, *DesiredPawnClass->GetName());
+		}
+		ActivePawn = nullptr;
+	}
+
+	if (!ActivePawn)
 	{
-		// UI-only panes do not need a local player or 3D viewport - just the HUD
-		if (Pane.bUIOnly)
+		FTransform SpawnTransform;
+		if (Pane.bUseCustomCameraTransform)
 		{
-			UE_LOG(LogViewportManager, Log, TEXT("UVMGameViewportClient::ApplyLayout - Pane %d is UI-only, skipping player setup"), Pane.LocalPlayerIndex);
-			continue;
+			SpawnTransform = Pane.CameraTransform;
 		}
-
-		if (Pane.LocalPlayerIndex < 0)
+		else if (Pane.bUseCustomFocusPoint)
 		{
-			UE_LOG(LogViewportManager, Warning, TEXT("UVMGameViewportClient::ApplyLayout - Invalid LocalPlayerIndex %d"), Pane.LocalPlayerIndex);
-			continue;
+			const FVector CameraLocation = Pane.FocusPoint + FVector(-Pane.OrbitDistance, 0.0f, Pane.OrbitDistance * 0.5f);
+			const FRotator CameraRotation = (Pane.FocusPoint - CameraLocation).Rotation();
+			SpawnTransform = FTransform(CameraRotation, CameraLocation, FVector::OneVector);
+		}
+		else
+		{
+			const FVector SpawnLocation = FVector(Pane.LocalPlayerIndex * 200.0f, 0.0f, 100.0f);
+			SpawnTransform = FTransform(FRotator::ZeroRotator, SpawnLocation, FVector::OneVector);
 		}
 
-		if (UsedIndices.Contains(Pane.LocalPlayerIndex))
+		ActivePawn = PawnPool.Acquire(DesiredPawnClass, GetWorld(), SpawnTransform);
+		const bool bReusedPawn = ActivePawn != nullptr;
+		if (!bReusedPawn)
 		{
-			UE_LOG(LogViewportManager, Warning, TEXT("UVMGameViewportClient::ApplyLayout - Duplicate LocalPlayerIndex %d"), Pane.LocalPlayerIndex);
-			continue;
+			PawnPool.NoteMiss();
+			ActivePawn = GetWorld()->SpawnActor<APawn>(DesiredPawnClass, SpawnTransform);
 		}
 
-		UsedIndices.Add(Pane.LocalPlayerIndex);
-		PlayerRects.Add(Pane.LocalPlayerIndex, Pane.Rect);
-	}
+		if (!ActivePawn)
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("Failed to spawn pawn of class %s for LocalPlayer %d."),
+				*DesiredPawnClass->GetName(), Pane.LocalPlayerIndex);
+			return;
+		}
 
-	const int32 ProcessedPanes = PlayerRects.Num();
+		if (Pane.bUseCustomCameraTransform)
+		{
+			PC->SetControlRotation(SpawnTransform.GetRotation().Rotator());
+		}
 
-	if (!PlayerRects.Contains(ActiveKeyboardMouseLP))
-	{
-		if (PlayerRects.Num() > 0)
+		PC->Possess(ActivePawn);
+		if (bReusedPawn)
 		{
-			ActiveKeyboardMouseLP = PlayerRects.CreateConstIterator()->Key;
+			++LastApplyStats.PawnsReused;
 		}
 		else
 		{
-			ActiveKeyboardMouseLP = 0;
+			++LastApplyStats.PawnsSpawned;
 		}
-	}
 
-	EnsureLocalPlayersExist();
-	SpawnAndPossessPawns();
-	EnsureCursorVisibility();
-	SetupViewportHUDs();
-	RefreshLayout();
+		if (Pane.bUseCustomCameraTransform)
+		{
+			PC->SetControlRotation(SpawnTransform.GetRotation().Rotator());
+		}
+
+		UE_LOG(LogVMLayout, Verbose, TEXT("%s %s for LocalPlayer %d at %s (rotation %s)"),
+			bReusedPawn ? TEXT("Reused") : TEXT("Spawned"), *DesiredPawnClass->GetName(), Pane.LocalPlayerIndex,
+			*ActivePawn->GetActorLocation().ToString(), *ActivePawn->GetActorRotation().ToString());
+	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("UVMGameViewportClient::ApplyLayout - Applied layout with %d panes"), ProcessedPanes);
+	ConfigurePawnForPane(ActivePawn, Pane, PC);
+	++LastApplyStats.PawnsConfigured;
 }
 
-void UVMGameViewportClient::RefreshLayout()
+TSoftClassPtr<APawn> UVMGameViewportClient::ResolvePawnClassRef(const FVMSplitPane& Pane)
 {
-	LayoutPlayers();
+	if (Pane.CameraMode == EVMViewportCameraMode::Custom && !Pane.GetCustomPawnClassRef().IsNull())
+	{
+		return Pane.GetCustomPawnClassRef();
+	}
+	return Pane.GetPawnClassRef();
 }
 
-void UVMGameViewportClient::SetActiveLocalPlayer(int32 LocalPlayerIndex)
+TSubclassOf<APawn> UVMGameViewportClient::ResolvePawnClass(const FVMSplitPane& Pane) const
 {
-	if (LocalPlayerIndex >= 0 && PlayerRects.Contains(LocalPlayerIndex))
+	const TSoftClassPtr<APawn> PawnClassRef = ResolvePawnClassRef(Pane);
+	if (!PawnClassRef.IsNull())
 	{
-		int32 OldPlayerIndex = FocusedPlayerIndex;
-		ActiveKeyboardMouseLP = LocalPlayerIndex;
-		FocusedPlayerIndex = LocalPlayerIndex;
-
-		if (OldPlayerIndex != FocusedPlayerIndex)
-		{
-			OnFocusChanged.Broadcast(OldPlayerIndex, FocusedPlayerIndex);
-			UE_LOG(LogViewportManager, Log, TEXT("Focus changed from player %d to player %d"), OldPlayerIndex, FocusedPlayerIndex);
-		}
-
-		UE_LOG(LogViewportManager, Log, TEXT("UVMGameViewportClient::SetActiveLocalPlayer - Set active player to %d"), LocalPlayerIndex);
+		return LoadPaneClass(PawnClassRef.ToSoftObjectPath(), Pane.ClassLoadPolicy);
 	}
-	else
+
+	switch (Pane.CameraMode)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMGameViewportClient::SetActiveLocalPlayer - LocalPlayerIndex %d is not part of the current layout"), LocalPlayerIndex);
+	case EVMViewportCameraMode::Free:
+		return AVMFreeCameraPawn::StaticClass();
+	case EVMViewportCameraMode::Custom:
+	case EVMViewportCameraMode::Orbit:
+	default:
+		return AVMCameraPawn::StaticClass();
 	}
 }
 
-void UVMGameViewportClient::EnsureLocalPlayersExist()
+UClass* UVMGameViewportClient::LoadPaneClass(const FSoftObjectPath& ClassPath, EVMPaneClassLoadPolicy LoadPolicy)
 {
-	if (!GetGameInstance())
+	if (UClass* LoadedClass = Cast<UClass>(ClassPath.ResolveObject()))
 	{
-		return;
+		return LoadedClass;
 	}
 
-	const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>();
-	const bool bAutoAddPlayers = Settings ? Settings->bAutoAddMissingLocalPlayers : true;
+	// OnFirstVisibility panes never block the game thread; the caller streams the class instead
+	if (LoadPolicy == EVMPaneClassLoadPolicy::OnFirstVisibility)
+	{
+		return nullptr;
+	}
 
-	for (auto& PlayerRectPair : PlayerRects)
+	UE_LOG(LogVMLayout, Log, TEXT("Loading pane class '%s' synchronously."), *ClassPath.ToString());
+	return Cast<UClass>(ClassPath.TryLoad());
+}
+
+bool UVMGameViewportClient::RequestDeferredPaneClasses(const FVMSplitPane& Pane)
+{
+	if (DeferredPaneClassLoads.Contains(Pane.LocalPlayerIndex))
 	{
-		const int32 LocalPlayerIndex = PlayerRectPair.Key;
+		return true;
+	}
 
-		if (GetGameInstance()->GetLocalPlayerByIndex(LocalPlayerIndex))
+	TArray<FSoftObjectPath> ClassPaths;
+	for (const FSoftObjectPath& ClassPath : { ResolvePawnClassRef(Pane).ToSoftObjectPath(), Pane.GetViewportHUDClassRef().ToSoftObjectPath() })
+	{
+		if (!ClassPath.IsNull() && !ClassPath.ResolveObject())
 		{
-			continue;
+			ClassPaths.Add(ClassPath);
 		}
+	}
 
-		const bool bShouldCreatePlayer = bAutoAddPlayers || (CurrentLayoutAsset && CurrentLayoutAsset->bAutoSpawnPlayers);
-		if (!bShouldCreatePlayer)
-		{
-			UE_LOG(LogViewportManager, Verbose, TEXT("Missing LocalPlayer %d but auto-spawn is disabled."), LocalPlayerIndex);
-			continue;
-		}
+	if (ClassPaths.Num() == 0)
+	{
+		return false;
+	}
 
-		FString CreatePlayerError;
-		ULocalPlayer* NewLocalPlayer = GetGameInstance()->CreateLocalPlayer(LocalPlayerIndex, CreatePlayerError, true);
-		if (NewLocalPlayer)
-		{
-			UE_LOG(LogViewportManager, Log, TEXT("Created LocalPlayer %d for layout."), LocalPlayerIndex);
-		}
-		else
+	UE_LOG(LogVMLayout, Log, TEXT("Streaming %d classes for pane %d on first visibility."), ClassPaths.Num(), Pane.LocalPlayerIndex);
+
+	// Register before requesting so a completion that fires synchronously still finds the entry
+	DeferredPaneClassLoads.Add(Pane.LocalPlayerIndex);
+	TSharedPtr<FStreamableHandle> Handle = PaneClassStreamer.RequestAsyncLoad(ClassPaths,
+		FStreamableDelegate::CreateUObject(this, &UVMGameViewportClient::OnDeferredPaneClassesLoaded, Pane.LocalPlayerIndex));
+
+	if (TSharedPtr<FStreamableHandle>* Pending = DeferredPaneClassLoads.Find(Pane.LocalPlayerIndex))
+	{
+		if (!Handle.IsValid())
 		{
-			UE_LOG(LogViewportManager, Warning, TEXT("Failed to create LocalPlayer %d."), LocalPlayerIndex);
-			if (!CreatePlayerError.IsEmpty())
-			{
-				UE_LOG(LogViewportManager, Warning, TEXT("CreateLocalPlayer error: %s"), *CreatePlayerError);
-			}
+			DeferredPaneClassLoads.Remove(Pane.LocalPlayerIndex);
+			return false;
 		}
+		*Pending = Handle;
 	}
+
+	return true;
 }
 
-void UVMGameViewportClient::SpawnAndPossessPawns()
+void UVMGameViewportClient::OnDeferredPaneClassesLoaded(int32 LocalPlayerIndex)
 {
-	if (!CurrentLayoutAsset || !GetWorld())
+	if (DeferredPaneClassLoads.Remove(LocalPlayerIndex) == 0 || !CurrentLayoutAsset || !GetWorld())
 	{
 		return;
 	}
 
-	for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
+	for (int32 PaneIndex = 0; PaneIndex < CurrentLayoutAsset->Panes.Num(); ++PaneIndex)
 	{
-		if (!PlayerRects.Contains(Pane.LocalPlayerIndex))
+		const FVMSplitPane& Pane = CurrentLayoutAsset->Panes[PaneIndex];
+		if (Pane.LocalPlayerIndex != LocalPlayerIndex)
 		{
 			continue;
 		}
 
-		ULocalPlayer* LocalPlayer = GetGameInstance()->GetLocalPlayerByIndex(Pane.LocalPlayerIndex);
-		if (!LocalPlayer)
+		if (Pane.NeedsLocalPlayer())
 		{
-			continue;
-		}
-
-		APlayerController* PC = LocalPlayer->GetPlayerController(GetWorld());
-		if (!PC)
-		{
-			continue;
-		}
-
-		const TSubclassOf<APawn> DesiredPawnClass = ResolvePawnClass(Pane);
-		if (!DesiredPawnClass)
-		{
-			UE_LOG(LogViewportManager, Warning, TEXT("Pane %d has no valid pawn class; skipping spawn."), Pane.LocalPlayerIndex);
-			continue;
-		}
-
-		APawn* ActivePawn = PC->GetPawn();
-		if (ActivePawn && ActivePawn->GetClass() != DesiredPawnClass.Get())
-		{
-			PC->UnPossess();
-			ActivePawn->Destroy();
-			ActivePawn = nullptr;
-
-			UE_LOG(LogViewportManager, Log, TEXT("Destroyed mismatched pawn for LocalPlayer %d (expected %s)."),
-				Pane.LocalPlayerIndex, *DesiredPawnClass->GetName());
-		}
-
-		if (!ActivePawn)
-		{
-			FTransform SpawnTransform;
-			if (Pane.bUseCustomCameraTransform)
-			{
-				SpawnTransform = Pane.CameraTransform;
-			}
-			else if (Pane.bUseCustomFocusPoint)
-			{
-				const FVector CameraLocation = Pane.FocusPoint + FVector(-Pane.OrbitDistance, 0.0f, Pane.OrbitDistance * 0.5f);
-				const FRotator CameraRotation = (Pane.FocusPoint - CameraLocation).Rotation();
-				SpawnTransform = FTransform(CameraRotation, CameraLocation, FVector::OneVector);
-			}
-			else
-			{
-				const FVector SpawnLocation = FVector(Pane.LocalPlayerIndex * 200.0f, 0.0f, 100.0f);
-				SpawnTransform = FTransform(FRotator::ZeroRotator, SpawnLocation, FVector::OneVector);
-			}
-
-			ActivePawn = GetWorld()->SpawnActor<APawn>(DesiredPawnClass, SpawnTransform);
-			if (!ActivePawn)
+			const int32 Slot = CompiledLayout.FindSlotForPlayer(LocalPlayerIndex);
+			if (Slot == INDEX_NONE || CompiledLayout.GetPaneIndex(Slot) != PaneIndex)
 			{
-				UE_LOG(LogViewportManager, Warning, TEXT("Failed to spawn pawn of class %s for LocalPlayer %d."),
-					*DesiredPawnClass->GetName(), Pane.LocalPlayerIndex);
 				continue;
 			}
 
-			if (Pane.bUseCustomCameraTransform)
-			{
-				PC->SetControlRotation(SpawnTransform.GetRotation().Rotator());
-			}
-
-			PC->Possess(ActivePawn);
-
-			if (Pane.bUseCustomCameraTransform)
-			{
-				PC->SetControlRotation(SpawnTransform.GetRotation().Rotator());
-			}
-
-			UE_LOG(LogViewportManager, Log, TEXT("Spawned %s for LocalPlayer %d at %s (rotation %s)"),
-				*DesiredPawnClass->GetName(), Pane.LocalPlayerIndex,
-				*ActivePawn->GetActorLocation().ToString(), *ActivePawn->GetActorRotation().ToString());
+			SpawnAndPossessPawnForPane(Pane);
+			ApplyCursorVisibility(LocalPlayerIndex);
 		}
 
-		ConfigurePawnForPane(ActivePawn, Pane, PC);
+		CreatePaneHUD(Pane);
 	}
+
+	UE_LOG(LogVMLayout, Log, TEXT("Pane %d classes streamed in; pane is now live."), LocalPlayerIndex);
 }
 
-TSubclassOf<APawn> UVMGameViewportClient::ResolvePawnClass(const FVMSplitPane& Pane) const
+void UVMGameViewportClient::CancelDeferredPaneClassLoads()
 {
-	switch (Pane.CameraMode)
+	TMap<int32, TSharedPtr<FStreamableHandle>> PendingLoads = MoveTemp(DeferredPaneClassLoads);
+	DeferredPaneClassLoads.Reset();
+
+	for (const auto& Pair : PendingLoads)
 	{
-	case EVMViewportCameraMode::Free:
-		if (Pane.PawnClass)
-		{
-			return Pane.PawnClass;
-		}
-		return AVMFreeCameraPawn::StaticClass();
-	case EVMViewportCameraMode::Custom:
-		if (Pane.CustomPawnClass)
-		{
-			return Pane.CustomPawnClass;
-		}
-		if (Pane.PawnClass)
-		{
-			return Pane.PawnClass;
-		}
-		return AVMCameraPawn::StaticClass();
-	case EVMViewportCameraMode::Orbit:
-	default:
-		if (Pane.PawnClass)
+		if (Pair.Value.IsValid())
 		{
-			return Pane.PawnClass;
+			Pair.Value->CancelHandle();
 		}
-		return AVMCameraPawn::StaticClass();
 	}
 }
 
@@ -490,18 +2144,20 @@ void UVMGameViewportClient::ConfigurePawnForPane(APawn* Pawn, const FVMSplitPane
 		return;
 	}
 
-	UE_LOG(LogViewportManager, Verbose, TEXT("Pane %d uses custom pawn %s; no automatic configuration applied."),
+	UE_LOG(LogVMLayout, Verbose, TEXT("Pane %d uses custom pawn %s; no automatic configuration applied."),
 		Pane.LocalPlayerIndex, *Pawn->GetClass()->GetName());
 }
 
 void UVMGameViewportClient::EnsureHUDRoot()
 {
+    LLM_SCOPE_BYTAG(ViewportManager_HUD);
+
     if (HUDRootWidget && HUDRootCanvas) return;
 
     HUDRootWidget = CreateWidget<UVMHUDRootWidget>(GetWorld(), UVMHUDRootWidget::StaticClass());
     if (!HUDRootWidget)
     {
-        UE_LOG(LogViewportManager, Error, TEXT("Failed to create HUD root widget"));
+        UE_LOG(LogVMHUD, Error, TEXT("Failed to create HUD root widget"));
         return;
     }
 
@@ -512,7 +2168,7 @@ void UVMGameViewportClient::EnsureHUDRoot()
 
     if (!HUDRootCanvas)
     {
-        UE_LOG(LogViewportManager, Error, TEXT("Failed to get root canvas from HUD root widget"));
+        UE_LOG(LogVMHUD, Error, TEXT("Failed to get root canvas from HUD root widget"));
         return;
     }
 
@@ -529,23 +2185,51 @@ void UVMGameViewportClient::ClearPaneHUDs()
             {
                 HUDRootCanvas->RemoveChild(W);
             }
-            W->RemoveFromParent();
+            HUDPool.Release(W, GetMaxPooledHUDsPerClass());
+            ++LastApplyStats.HUDsRemoved;
         }
     }
     ActivePaneHUDs.Empty();
 }
 
+void UVMGameViewportClient::RemovePaneHUD(int32 LocalPlayerIndex)
+{
+	TWeakObjectPtr<UUserWidget> Existing;
+	if (!ActivePaneHUDs.RemoveAndCopyValue(LocalPlayerIndex, Existing))
+	{
+		return;
+	}
+
+	if (UUserWidget* W = Existing.Get())
+	{
+		if (HUDRootCanvas)
+		{
+			HUDRootCanvas->RemoveChild(W);
+		}
+		HUDPool.Release(W, GetMaxPooledHUDsPerClass());
+		++LastApplyStats.HUDsRemoved;
+	}
+}
+
 void UVMGameViewportClient::SetupViewportHUDs()
 {
+    VM_SCOPE_CYCLE_COUNTER(STAT_VM_SetupViewportHUDs);
+
     if (!CurrentLayoutAsset || !GetWorld()) return;
 
     ClearPaneHUDs();
 
+    // Pooled widgets are owned by the previous world's controllers and cannot be reattached after travel
+    if (AppliedWorld.Get() != GetWorld())
+    {
+        HUDPool.Reset();
+    }
+
     bool bHasAnyHUDs = false;
     for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
     {
         // Check both regular panes (in PlayerRects) and UI-only panes
-        if (Pane.ViewportHUDClass && (PlayerRects.Contains(Pane.LocalPlayerIndex) || Pane.bUIOnly))
+        if (!Pane.GetViewportHUDClassRef().IsNull() && (PlayerRects.Contains(Pane.LocalPlayerIndex) || !Pane.NeedsLocalPlayer()))
         {
             bHasAnyHUDs = true;
             break;
@@ -554,83 +2238,160 @@ void UVMGameViewportClient::SetupViewportHUDs()
 
     if (!bHasAnyHUDs)
     {
-        UE_LOG(LogViewportManager, Log, TEXT("No HUD classes assigned to any panes, skipping HUD setup"));
+        UE_LOG(LogVMHUD, Verbose, TEXT("No HUD classes assigned to any panes, skipping HUD setup"));
         return;
     }
 
     EnsureHUDRoot();
     if (!HUDRootCanvas)
     {
-        UE_LOG(LogViewportManager, Warning, TEXT("Failed to create HUD root canvas"));
+        UE_LOG(LogVMHUD, Warning, TEXT("Failed to create HUD root canvas"));
         return;
     }
 
     for (const FVMSplitPane& Pane : CurrentLayoutAsset->Panes)
     {
-        if (!Pane.ViewportHUDClass) continue;
+        CreatePaneHUD(Pane);
+    }
+}
+
+void UVMGameViewportClient::CreatePaneHUD(const FVMSplitPane& Pane)
+{
+	LLM_SCOPE_BYTAG(ViewportManager_HUD);
 
-        UUserWidget* HUD = nullptr;
-        FVMSplitRect R;
+	const TSoftClassPtr<UUserWidget> HUDClassRef = Pane.GetViewportHUDClassRef();
+	if (HUDClassRef.IsNull()) return;
 
-        if (Pane.bUIOnly)
-        {
-            // UI-only panes don't have a LocalPlayer - create widget with World
-            HUD = CreateWidget<UUserWidget>(GetWorld(), Pane.ViewportHUDClass);
-            R = Pane.Rect;
-        }
-        else
-        {
-            // Regular panes need to be in PlayerRects and have a LocalPlayer
-            if (!PlayerRects.Contains(Pane.LocalPlayerIndex)) continue;
+	// A pane that already shows a HUD (e.g. created when its deferred classes arrived) keeps it
+	const TWeakObjectPtr<UUserWidget>* ExistingHUD = ActivePaneHUDs.Find(Pane.LocalPlayerIndex);
+	if (ExistingHUD && ExistingHUD->IsValid()) return;
 
-            ULocalPlayer* LP = GetGameInstance()->GetLocalPlayerByIndex(Pane.LocalPlayerIndex);
-            if (!LP) continue;
+	EnsureHUDRoot();
+	if (!HUDRootCanvas) return;
 
-            APlayerController* PC = LP->GetPlayerController(GetWorld());
-            if (!PC) continue;
+	FVMSplitRect R;
+	APlayerController* PC = nullptr;
 
-            HUD = CreateWidget<UUserWidget>(PC, Pane.ViewportHUDClass);
-            R = PlayerRects[Pane.LocalPlayerIndex];
-        }
+	if (!Pane.NeedsLocalPlayer())
+	{
+		R = Pane.Rect;
+	}
+	else
+	{
+		// Regular panes need to be in PlayerRects and have a LocalPlayer
+		if (!PlayerRects.Contains(Pane.LocalPlayerIndex)) return;
+
+		ULocalPlayer* LP = GetGameInstance()->GetLocalPlayerByIndex(Pane.LocalPlayerIndex);
+		if (!LP) return;
+
+		PC = LP->GetPlayerController(GetWorld());
+		if (!PC) return;
+
+		R = PlayerRects[Pane.LocalPlayerIndex];
+	}
+
+	const TSubclassOf<UUserWidget> HUDClass = LoadPaneClass(HUDClassRef.ToSoftObjectPath(), Pane.ClassLoadPolicy);
+	if (!HUDClass)
+	{
+		if (Pane.ClassLoadPolicy == EVMPaneClassLoadPolicy::OnFirstVisibility && RequestDeferredPaneClasses(Pane)) return;
 
-        if (!HUD) continue;
+		UE_LOG(LogVMHUD, Warning, TEXT("Failed to load HUD class '%s' for pane %d"), *HUDClassRef.ToString(), Pane.LocalPlayerIndex);
+		return;
+	}
 
-        UCanvasPanelSlot* Slot = HUDRootCanvas->AddChildToCanvas(HUD);
-        if (!Slot) { HUD->RemoveFromParent(); continue; }
+	UUserWidget* HUD = HUDPool.Acquire(HUDClass, PC);
+	if (HUD)
+	{
+		++LastApplyStats.HUDsReused;
+	}
+	else
+	{
+		HUDPool.NoteMiss();
 
-        const float MinX = R.Origin01.X;
-        const float MinY = R.Origin01.Y;
-        const float MaxX = R.Origin01.X + R.Size01.X;
-        const float MaxY = R.Origin01.Y + R.Size01.Y;
+		// UI-only panes don't have a LocalPlayer - create widget with World
+		HUD = PC ? CreateWidget<UUserWidget>(PC, HUDClass) : CreateWidget<UUserWidget>(GetWorld(), HUDClass);
+		if (!HUD) return;
 
-        Slot->SetAnchors(FAnchors(MinX, MinY, MaxX, MaxY));
-        Slot->SetOffsets(FMargin(0, 0, 0, 0));
-        Slot->SetAlignment(FVector2D(0.f, 0.f));
+		++LastApplyStats.HUDsCreated;
+	}
 
-		HUD->SetClipping(EWidgetClipping::ClipToBounds);
-		HUD->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
+	UCanvasPanelSlot* Slot = HUDRootCanvas->AddChildToCanvas(HUD);
+	if (!Slot) { HUD->RemoveFromParent(); return; }
 
-		ActivePaneHUDs.Add(Pane.LocalPlayerIndex, HUD);
+	ApplyHUDSlotRect(Slot, R);
 
-		if (UVMViewportHUDWidget* VMHUD = Cast<UVMViewportHUDWidget>(HUD))
-		{
-			VMHUD->SetViewportInfo(Pane.LocalPlayerIndex, R);
-		}
+	HUD->SetClipping(EWidgetClipping::ClipToBounds);
+	HUD->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
 
-		UE_LOG(LogViewportManager, Log, TEXT("HUD added for %s pane %d with anchors (%.2f,%.2f)-(%.2f,%.2f)"),
-			Pane.bUIOnly ? TEXT("UI-only") : TEXT("regular"),
-			Pane.LocalPlayerIndex, MinX, MinY, MaxX, MaxY);
+	ActivePaneHUDs.Add(Pane.LocalPlayerIndex, HUD);
+
+	if (UVMViewportHUDWidget* VMHUD = Cast<UVMViewportHUDWidget>(HUD))
+	{
+		VMHUD->SetViewportInfo(Pane.LocalPlayerIndex, R);
+
+		// Pooled widgets may still carry the divisor of the pane they were last attached to
+		const int32 PaneIndex = CurrentLayoutAsset ? CurrentLayoutAsset->Panes.IndexOfByPredicate([&Pane](const FVMSplitPane& Candidate) { return &Candidate == &Pane; }) : INDEX_NONE;
+		VMHUD->SetUpdateDivisor(GetEffectiveUpdateDivisor(PaneIndex));
+	}
+
+	UE_LOG(LogVMHUD, Verbose, TEXT("HUD added for %s pane %d with anchors (%.2f,%.2f)-(%.2f,%.2f)"),
+		Pane.bUIOnly ? TEXT("UI-only") : (Pane.bViewOnly ? TEXT("view-only") : (Pane.bMirror ? TEXT("mirror") : TEXT("regular"))),
+		Pane.LocalPlayerIndex, R.Origin01.X, R.Origin01.Y, R.Origin01.X + R.Size01.X, R.Origin01.Y + R.Size01.Y);
+}
+
+int32 UVMGameViewportClient::GetMaxPooledHUDsPerClass()
+{
+	const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>();
+	return Settings ? Settings->MaxPooledHUDWidgetsPerClass : 0;
+}
+
+int32 UVMGameViewportClient::GetMaxPooledPawnsPerClass()
+{
+	const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>();
+	return Settings ? Settings->MaxPooledPawnsPerClass : 0;
+}
+
+void UVMGameViewportClient::UpdatePaneHUDRect(int32 LocalPlayerIndex, const FVMSplitRect& Rect)
+{
+	const TWeakObjectPtr<UUserWidget>* Existing = ActivePaneHUDs.Find(LocalPlayerIndex);
+	UUserWidget* HUD = Existing ? Existing->Get() : nullptr;
+	if (!HUD)
+	{
+		return;
+	}
+
+	if (UCanvasPanelSlot* Slot = Cast<UCanvasPanelSlot>(HUD->Slot))
+	{
+		ApplyHUDSlotRect(Slot, Rect);
+	}
+
+	if (UVMViewportHUDWidget* VMHUD = Cast<UVMViewportHUDWidget>(HUD))
+	{
+		VMHUD->SetViewportInfo(LocalPlayerIndex, Rect);
 	}
+
+	++LastApplyStats.HUDsRepositioned;
+}
+
+void UVMGameViewportClient::ApplyHUDSlotRect(UCanvasPanelSlot* Slot, const FVMSplitRect& Rect)
+{
+	const float MinX = Rect.Origin01.X;
+	const float MinY = Rect.Origin01.Y;
+	const float MaxX = Rect.Origin01.X + Rect.Size01.X;
+	const float MaxY = Rect.Origin01.Y + Rect.Size01.Y;
+
+	Slot->SetAnchors(FAnchors(MinX, MinY, MaxX, MaxY));
+	Slot->SetOffsets(FMargin(0, 0, 0, 0));
+	Slot->SetAlignment(FVector2D(0.f, 0.f));
 }
 
-void UVMGameViewportClient::HandleClickToFocus(const FVector2D& ScreenPosition)
+void UVMGameViewportClient::HandleClickToFocus(int32 PaneIndex)
 {
 	if (!bClickToFocusEnabled)
 	{
 		return;
 	}
 
-	int32 PaneIndex = FindPaneAtScreenPosition(ScreenPosition);
 	if (PaneIndex != -1)
 	{
 		if (PaneIndex != FocusedPlayerIndex)
@@ -643,15 +2404,9 @@ void UVMGameViewportClient::HandleClickToFocus(const FVector2D& ScreenPosition)
 			if (APlayerController* PC = LocalPlayer->GetPlayerController(GetWorld()))
 			{
 				bool bWantCursorVisible = true;
-				if (CurrentLayoutAsset)
+				if (const FVMSplitPane* Pane = FindPaneForPlayer(PaneIndex))
 				{
-					if (const FVMSplitPane* Pane = CurrentLayoutAsset->Panes.FindByPredicate([PaneIndex](const FVMSplitPane& Candidate)
-						{
-							return Candidate.LocalPlayerIndex == PaneIndex;
-						}))
-					{
-						bWantCursorVisible = Pane->CameraControls.bKeepMouseCursorVisible;
-					}
+					bWantCursorVisible = Pane->CameraControls.bKeepMouseCursorVisible;
 				}
 
 				PC->bShowMouseCursor = bWantCursorVisible;
@@ -660,69 +2415,69 @@ void UVMGameViewportClient::HandleClickToFocus(const FVector2D& ScreenPosition)
 					PC->SetInputMode(FInputModeGameAndUI());
 				}
 
-				UE_LOG(LogViewportManager, Verbose, TEXT("HandleClickToFocus - Pane %d focused, cursor %s"),
+				UE_LOG(LogVMInput, Verbose, TEXT("HandleClickToFocus - Pane %d focused, cursor %s"),
 					PaneIndex, bWantCursorVisible ? TEXT("visible") : TEXT("hidden"));
 			}
 		}
 	}
 }
 
-int32 UVMGameViewportClient::FindPaneAtScreenPosition(const FVector2D& ScreenPosition) const
+const FVMSplitPane* UVMGameViewportClient::FindPaneForPlayer(int32 LocalPlayerIndex) const
 {
-	for (auto& PlayerRectPair : PlayerRects)
+	if (!CurrentLayoutAsset)
 	{
-		int32 LocalPlayerIndex = PlayerRectPair.Key;
-		const FVMSplitRect& Rect = PlayerRectPair.Value;
+		return nullptr;
+	}
 
-		if (ScreenPosition.X >= Rect.Origin01.X && ScreenPosition.X <= (Rect.Origin01.X + Rect.Size01.X) &&
-			ScreenPosition.Y >= Rect.Origin01.Y && ScreenPosition.Y <= (Rect.Origin01.Y + Rect.Size01.Y))
-		{
-			return LocalPlayerIndex;
-		}
+	const int32 Slot = CompiledLayout.FindSlotForPlayer(LocalPlayerIndex);
+	if (Slot == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	// The asset is editable at runtime, so guard against a stale compiled index
+	const int32 PaneIndex = CompiledLayout.GetPaneIndex(Slot);
+	if (!CurrentLayoutAsset->Panes.IsValidIndex(PaneIndex) || CurrentLayoutAsset->Panes[PaneIndex].LocalPlayerIndex != LocalPlayerIndex)
+	{
+		return nullptr;
 	}
 
-	return -1;
+	return &CurrentLayoutAsset->Panes[PaneIndex];
 }
 
 void UVMGameViewportClient::EnsureCursorVisibility()
 {
 	for (auto& PlayerRectPair : PlayerRects)
 	{
-		int32 LocalPlayerIndex = PlayerRectPair.Key;
-		if (ULocalPlayer* LocalPlayer = GetGameInstance()->GetLocalPlayerByIndex(LocalPlayerIndex))
+		ApplyCursorVisibility(PlayerRectPair.Key);
+	}
+}
+
+void UVMGameViewportClient::ApplyCursorVisibility(int32 LocalPlayerIndex)
+{
+	if (ULocalPlayer* LocalPlayer = GetGameInstance()->GetLocalPlayerByIndex(LocalPlayerIndex))
+	{
+		bool bWantCursorVisible = true;
+		if (const FVMSplitPane* Pane = FindPaneForPlayer(LocalPlayerIndex))
+		{
+			bWantCursorVisible = Pane->CameraControls.bKeepMouseCursorVisible;
+		}
+
+		if (APlayerController* PC = LocalPlayer->GetPlayerController(GetWorld()))
 		{
-			bool bWantCursorVisible = true;
-			if (CurrentLayoutAsset)
+			PC->bShowMouseCursor = bWantCursorVisible;
+			if (bWantCursorVisible)
 			{
-				if (const FVMSplitPane* Pane = CurrentLayoutAsset->Panes.FindByPredicate([LocalPlayerIndex](const FVMSplitPane& Candidate)
-					{
-						return Candidate.LocalPlayerIndex == LocalPlayerIndex;
-					}))
-				{
-					bWantCursorVisible = Pane->CameraControls.bKeepMouseCursorVisible;
-				}
+				PC->SetInputMode(FInputModeGameAndUI());
 			}
-
-			if (APlayerController* PC = LocalPlayer->GetPlayerController(GetWorld()))
+			else
 			{
-				PC->bShowMouseCursor = bWantCursorVisible;
-				if (bWantCursorVisible)
-				{
-					PC->SetInputMode(FInputModeGameAndUI());
-				}
-				else
-				{
-					PC->SetInputMode(FInputModeGameOnly());
-				}
-
-				UE_LOG(LogViewportManager, Verbose, TEXT("EnsureCursorVisibility -> LP%d cursor %s"),
-					LocalPlayerIndex,
-					bWantCursorVisible ? TEXT("visible") : TEXT("hidden"));
+				PC->SetInputMode(FInputModeGameOnly());
 			}
+
+			UE_LOG(LogVMInput, Verbose, TEXT("EnsureCursorVisibility -> LP%d cursor %s"),
+				LocalPlayerIndex,
+				bWantCursorVisible ? TEXT("visible") : TEXT("hidden"));
 		}
 	}
 }
-
-
-
-
@@ -28,7 +28,7 @@ void UVMHUDRootWidget::EnsureRootCanvas()
 		RootCanvas = Cast<UCanvasPanel>(WidgetTree->RootWidget);
 		if (RootCanvas)
 		{
-			UE_LOG(LogViewportManager, Log, TEXT("UVMHUDRootWidget::EnsureRootCanvas - Found existing Canvas Panel from Blueprint"));
+			UE_LOG(LogVMHUD, Log, TEXT("UVMHUDRootWidget::EnsureRootCanvas - Found existing Canvas Panel from Blueprint"));
 			return;
 		}
 	}
@@ -38,11 +38,11 @@ void UVMHUDRootWidget::EnsureRootCanvas()
 		RootCanvas = WidgetTree->ConstructWidget<UCanvasPanel>(UCanvasPanel::StaticClass(), TEXT("RootCanvas"));
 		WidgetTree->RootWidget = RootCanvas;
 		
-		UE_LOG(LogViewportManager, Log, TEXT("UVMHUDRootWidget::EnsureRootCanvas - Created root canvas programmatically"));
+		UE_LOG(LogVMHUD, Log, TEXT("UVMHUDRootWidget::EnsureRootCanvas - Created root canvas programmatically"));
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Error, TEXT("UVMHUDRootWidget::EnsureRootCanvas - WidgetTree is null!"));
+		UE_LOG(LogVMHUD, Error, TEXT("UVMHUDRootWidget::EnsureRootCanvas - WidgetTree is null!"));
 	}
 }
 
@@ -0,0 +1,94 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMHUDWidgetPool.h"
+#include "GameFramework/PlayerController.h"
+#include "VMLog.h"
+
+UUserWidget* FVMHUDWidgetPool::Acquire(TSubclassOf<UUserWidget> WidgetClass, APlayerController* OwningPlayer)
+{
+	FVMHUDWidgetPoolBucket* Bucket = Buckets.Find(WidgetClass.Get());
+	if (!Bucket)
+	{
+		return nullptr;
+	}
+
+	// UI-only panes own their widgets through the world rather than a player, so only hand
+	// back widgets whose ownership can be rebound to the requested owner
+	for (int32 i = Bucket->IdleWidgets.Num() - 1; i >= 0; --i)
+	{
+		UUserWidget* Widget = Bucket->IdleWidgets[i];
+		if (!IsValid(Widget))
+		{
+			Bucket->IdleWidgets.RemoveAtSwap(i);
+			continue;
+		}
+
+		const bool bHasOwner = Widget->GetOwningPlayer() != nullptr;
+		if (bHasOwner != (OwningPlayer != nullptr))
+		{
+			continue;
+		}
+
+		Bucket->IdleWidgets.RemoveAtSwap(i);
+		if (OwningPlayer && Widget->GetOwningPlayer() != OwningPlayer)
+		{
+			Widget->SetOwningPlayer(OwningPlayer);
+		}
+
+		++Stats.Reuses;
+		return Widget;
+	}
+
+	return nullptr;
+}
+
+void FVMHUDWidgetPool::Release(UUserWidget* Widget, int32 MaxIdlePerClass)
+{
+	if (!IsValid(Widget))
+	{
+		return;
+	}
+
+	Widget->RemoveFromParent();
+
+	FVMHUDWidgetPoolBucket& Bucket = Buckets.FindOrAdd(Widget->GetClass());
+	if (Bucket.IdleWidgets.Num() >= MaxIdlePerClass)
+	{
+		++Stats.Evicted;
+		UE_LOG(LogVMHUD, Verbose, TEXT("HUD pool full for %s; releasing widget to GC"), *Widget->GetClass()->GetName());
+		return;
+	}
+
+	Bucket.IdleWidgets.Add(Widget);
+	++Stats.Released;
+}
+
+void FVMHUDWidgetPool::Reset()
+{
+	Buckets.Empty();
+}
+
+FVMHUDWidgetPoolStats FVMHUDWidgetPool::GetStats() const
+{
+	FVMHUDWidgetPoolStats Result = Stats;
+	Result.IdleWidgets = 0;
+	for (const auto& Pair : Buckets)
+	{
+		Result.IdleWidgets += Pair.Value.IdleWidgets.Num();
+	}
+	return Result;
+}
+
+void FVMHUDWidgetPool::GetIdleWidgets(TArray<UUserWidget*>& OutWidgets) const
+{
+	for (const auto& Pair : Buckets)
+	{
+		for (UUserWidget* Widget : Pair.Value.IdleWidgets)
+		{
+			if (Widget)
+			{
+				OutWidgets.Add(Widget);
+			}
+		}
+	}
+}
@@ -0,0 +1,189 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMInputRouting.h"
+#include "InputKeyEventArgs.h"
+#include "VMCompiledLayout.h"
+#include "VMLog.h"
+
+namespace VMInputRouting
+{
+	/** Layout routing for keyboard or mouse, with Fixed resolved to the pane flagged as the target. */
+	static FVMInputRoute MakeKeyboardMouseRoute(EVMInputRoutingPolicy Policy, int32 FixedTarget, const TCHAR* DeviceName)
+	{
+		FVMInputRoute Route;
+		Route.Policy = Policy;
+
+		if (Policy == EVMInputRoutingPolicy::Fixed)
+		{
+			if (FixedTarget == INDEX_NONE)
+			{
+				UE_LOG(LogVMInput, Warning, TEXT("Layout routes %s input Fixed but no pane is a fixed keyboard/mouse target; routing by hover"), DeviceName);
+				Route.Policy = EVMInputRoutingPolicy::Hover;
+			}
+			Route.LocalPlayerIndex = FixedTarget;
+		}
+
+		return Route;
+	}
+
+	/** Fixed routes need their player in the layout; anything else applies to any layout. */
+	static bool CanApply(const FVMInputRoute& Route, const FVMCompiledLayout& Compiled)
+	{
+		return Route.Policy != EVMInputRoutingPolicy::Fixed || Compiled.FindSlotForPlayer(Route.LocalPlayerIndex) != INDEX_NONE;
+	}
+}
+
+void FVMInputRoutingTable::Rebuild(const UVMSplitLayoutAsset& Layout, const FVMCompiledLayout& Compiled)
+{
+	Reset();
+
+	int32 FixedTarget = INDEX_NONE;
+	for (int32 Slot = 0; Slot < Compiled.Num(); ++Slot)
+	{
+		const int32 LocalPlayerIndex = Compiled.GetLocalPlayerIndex(Slot);
+		const FVMSplitPane& Pane = Layout.Panes[Compiled.GetPaneIndex(Slot)];
+
+		if (Compiled.GetFlags(Slot) & FVMCompiledLayout::ReceivesKeyboardMouse)
+		{
+			BroadcastPlayers.Add(LocalPlayerIndex);
+		}
+
+		// Slots are stored top-most first, so the top-most flagged pane wins
+		if (Pane.bFixedKeyboardMouseTarget && FixedTarget == INDEX_NONE)
+		{
+			FixedTarget = LocalPlayerIndex;
+		}
+
+		if (Pane.GamepadIndex >= 0 && !FindRoute(EVMInputDeviceType::Gamepad, Pane.GamepadIndex))
+		{
+			FVMInputRoute GamepadRoute;
+			GamepadRoute.Policy = EVMInputRoutingPolicy::Fixed;
+			GamepadRoute.LocalPlayerIndex = LocalPlayerIndex;
+			WriteRoute(EVMInputDeviceType::Gamepad, Pane.GamepadIndex, GamepadRoute);
+		}
+	}
+
+	KeyboardRoute = VMInputRouting::MakeKeyboardMouseRoute(Layout.KeyboardRouting, FixedTarget, TEXT("keyboard"));
+	MouseRoute = VMInputRouting::MakeKeyboardMouseRoute(Layout.MouseRouting, FixedTarget, TEXT("mouse"));
+
+	ApplyOverrides(Compiled);
+}
+
+void FVMInputRoutingTable::ApplyOverrides(const FVMCompiledLayout& Compiled)
+{
+	// Fixed overrides whose player has no pane stay stored and come back once a layout shows that player
+	if (KeyboardOverride.IsSet() && VMInputRouting::CanApply(*KeyboardOverride, Compiled))
+	{
+		KeyboardRoute = *KeyboardOverride;
+	}
+
+	if (MouseOverride.IsSet() && VMInputRouting::CanApply(*MouseOverride, Compiled))
+	{
+		MouseRoute = *MouseOverride;
+	}
+
+	for (const TPair<int32, TOptional<FVMInputRoute>>& Override : GamepadOverrides)
+	{
+		if (!Override.Value.IsSet() || VMInputRouting::CanApply(*Override.Value, Compiled))
+		{
+			WriteRoute(EVMInputDeviceType::Gamepad, Override.Key, Override.Value);
+		}
+	}
+}
+
+void FVMInputRoutingTable::Reset()
+{
+	KeyboardRoute = FVMInputRoute();
+	MouseRoute = FVMInputRoute();
+	GamepadRoutes.Reset();
+	BroadcastPlayers.Reset();
+}
+
+void FVMInputRoutingTable::ResetOverrides()
+{
+	KeyboardOverride.Reset();
+	MouseOverride.Reset();
+	GamepadOverrides.Reset();
+}
+
+const FVMInputRoute* FVMInputRoutingTable::FindRoute(const FInputKeyEventArgs& EventArgs) const
+{
+	return FindRoute(GetDeviceType(EventArgs), EventArgs.ControllerId);
+}
+
+const FVMInputRoute* FVMInputRoutingTable::FindRoute(EVMInputDeviceType Device, int32 GamepadIndex) const
+{
+	switch (Device)
+	{
+	case EVMInputDeviceType::Keyboard:
+		return &KeyboardRoute;
+	case EVMInputDeviceType::Mouse:
+		return &MouseRoute;
+	default:
+		return GamepadRoutes.IsValidIndex(GamepadIndex) && GamepadRoutes[GamepadIndex].IsSet() ? &GamepadRoutes[GamepadIndex].GetValue() : nullptr;
+	}
+}
+
+void FVMInputRoutingTable::SetRoute(EVMInputDeviceType Device, int32 GamepadIndex, const FVMInputRoute& Route)
+{
+	switch (Device)
+	{
+	case EVMInputDeviceType::Keyboard:
+		KeyboardOverride = Route;
+		break;
+	case EVMInputDeviceType::Mouse:
+		MouseOverride = Route;
+		break;
+	default:
+		if (GamepadIndex >= 0)
+		{
+			GamepadOverrides.Add(GamepadIndex, Route);
+		}
+		break;
+	}
+
+	WriteRoute(Device, GamepadIndex, Route);
+}
+
+void FVMInputRoutingTable::ClearGamepadRoute(int32 GamepadIndex)
+{
+	if (GamepadIndex >= 0)
+	{
+		GamepadOverrides.Add(GamepadIndex, TOptional<FVMInputRoute>());
+		WriteRoute(EVMInputDeviceType::Gamepad, GamepadIndex, TOptional<FVMInputRoute>());
+	}
+}
+
+void FVMInputRoutingTable::WriteRoute(EVMInputDeviceType Device, int32 GamepadIndex, const TOptional<FVMInputRoute>& Route)
+{
+	switch (Device)
+	{
+	case EVMInputDeviceType::Keyboard:
+		KeyboardRoute = Route.Get(FVMInputRoute());
+		break;
+	case EVMInputDeviceType::Mouse:
+		MouseRoute = Route.Get(FVMInputRoute());
+		break;
+	default:
+		if (GamepadIndex >= 0)
+		{
+			if (GamepadIndex >= GamepadRoutes.Num())
+			{
+				GamepadRoutes.SetNum(GamepadIndex + 1);
+			}
+			GamepadRoutes[GamepadIndex] = Route;
+		}
+		break;
+	}
+}
+
+EVMInputDeviceType FVMInputRoutingTable::GetDeviceType(const FInputKeyEventArgs& EventArgs)
+{
+	if (EventArgs.IsGamepad())
+	{
+		return EVMInputDeviceType::Gamepad;
+	}
+
+	// Mouse axes carry the mouse button flag too
+	return EventArgs.Key.IsMouseButton() ? EVMInputDeviceType::Mouse : EVMInputDeviceType::Keyboard;
+}
@@ -54,7 +54,7 @@ void UVMInputSetupHelper::SetupEnhancedInputAssets()
 		if (UPackage::SavePackage(Package, InputAction, *PackageFileName, SaveArgs))
 		{
 			CreatedAssets.Add(AssetName);
-			UE_LOG(LogViewportManager, Log, TEXT("Created InputAction: %s"), *AssetName);
+			UE_LOG(LogVMInput, Log, TEXT("Created InputAction: %s"), *AssetName);
 			return InputAction;
 		}
 		else
@@ -64,7 +64,7 @@ void UVMInputSetupHelper::SetupEnhancedInputAssets()
 		}
 	};
 
-	UE_LOG(LogViewportManager, Log, TEXT("=== Starting Enhanced Input Setup ==="));
+	UE_LOG(LogVMInput, Log, TEXT("=== Starting Enhanced Input Setup ==="));
 
 	UInputAction* IA_Look = CreateInputAction(TEXT("IA_Look"), EInputActionValueType::Axis2D);
 	UInputAction* IA_Zoom = CreateInputAction(TEXT("IA_Zoom"), EInputActionValueType::Axis1D);
@@ -108,7 +108,7 @@ void UVMInputSetupHelper::SetupEnhancedInputAssets()
 	ResultMessage += TEXT("   - IA_Sprint → Left Shift\n");
 	ResultMessage += TEXT("3. Assign the InputActions to your camera pawns\n");
 
-	UE_LOG(LogViewportManager, Log, TEXT("%s"), *ResultMessage);
+	UE_LOG(LogVMInput, Log, TEXT("%s"), *ResultMessage);
 
 	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ResultMessage));
 
@@ -116,6 +116,6 @@ void UVMInputSetupHelper::SetupEnhancedInputAssets()
 	AssetRegistryModule.Get().ScanPathsSynchronous({ InputFolder }, true);
 
 #else
-	UE_LOG(LogViewportManager, Warning, TEXT("SetupEnhancedInputAssets can only be called in the editor"));
+	UE_LOG(LogVMInput, Warning, TEXT("SetupEnhancedInputAssets can only be called in the editor"));
 #endif
 }
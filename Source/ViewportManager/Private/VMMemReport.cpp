@@ -0,0 +1,85 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+#include "VMGameViewportClient.h"
+#include "VMLog.h"
+
+#if !UE_BUILD_SHIPPING
+
+namespace VMMemReport
+{
+	static double ToKB(int64 Bytes)
+	{
+		return Bytes / 1024.0;
+	}
+
+	static void RunMemReport(const TArray<FString>& Args, UWorld* World)
+	{
+		UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		const UVMGameViewportClient* ViewportClient = GameInstance ? Cast<UVMGameViewportClient>(GameInstance->GetGameViewportClient()) : nullptr;
+		if (!ViewportClient)
+		{
+			UE_LOG(LogViewportManager, Warning, TEXT("vm.MemReport needs a game world shown through UVMGameViewportClient"));
+			return;
+		}
+
+		// Without a collection, widgets released a moment ago still show up as untracked
+		if (Args.Contains(TEXT("Gc")))
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+
+		const UVMSplitLayoutAsset* Layout = ViewportClient->GetCurrentLayout();
+		UE_LOG(LogViewportManager, Display, TEXT("vm.MemReport - Layout %s, estimated UObject memory:"), Layout ? *Layout->GetName() : TEXT("None"));
+
+		int32 NumPawns = 0;
+		int32 NumHUDs = 0;
+		int64 PaneBytes = 0;
+		for (const FVMPaneMemoryStats& Pane : ViewportClient->GetPaneMemoryStats())
+		{
+			NumPawns += Pane.bHasPawn ? 1 : 0;
+			NumHUDs += Pane.bHasHUD ? 1 : 0;
+			PaneBytes += Pane.PawnBytes + Pane.HUDBytes;
+
+			UE_LOG(LogViewportManager, Display, TEXT("  Pane %d (LP%d)%s: pawn %s %.1f KB, HUD %s %.1f KB"),
+				Pane.PaneIndex, Pane.LocalPlayerIndex, Pane.bDormant ? TEXT(" dormant") : TEXT(""),
+				Pane.bHasPawn ? TEXT("yes") : TEXT("no"), ToKB(Pane.PawnBytes),
+				Pane.bHasHUD ? TEXT("yes") : TEXT("no"), ToKB(Pane.HUDBytes));
+		}
+
+		const FVMMemoryStats Stats = ViewportClient->GetMemoryStats();
+		const FVMHUDWidgetPoolStats HUDPool = ViewportClient->GetHUDPoolStats();
+		const FVMPawnPoolStats PawnPool = ViewportClient->GetPawnPoolStats();
+
+		UE_LOG(LogViewportManager, Display, TEXT("  Panes: %d pawns, %d HUDs, %.1f KB"), NumPawns, NumHUDs, ToKB(PaneBytes));
+		UE_LOG(LogViewportManager, Display, TEXT("  Layout data: %.1f KB, HUD root: %.1f KB"), ToKB(Stats.LayoutBytes), ToKB(Stats.HUDRootBytes));
+		UE_LOG(LogViewportManager, Display, TEXT("  HUD pool: %d idle, %.1f KB (%d reuses, %d misses, %d evicted)"),
+			Stats.IdleHUDs, ToKB(Stats.IdleHUDBytes), HUDPool.Reuses, HUDPool.Misses, HUDPool.Evicted);
+		UE_LOG(LogViewportManager, Display, TEXT("  Pawn pool: %d parked, %.1f KB (%d reuses, %d misses, %d evicted)"),
+			Stats.IdlePawns, ToKB(Stats.IdlePawnBytes), PawnPool.Reuses, PawnPool.Misses, PawnPool.Evicted);
+
+		if (Stats.UntrackedHUDs > 0 || Stats.UntrackedPawns > 0)
+		{
+			UE_LOG(LogViewportManager, Warning, TEXT("  Untracked: %d HUDs %.1f KB, %d pawns %.1f KB%s"),
+				Stats.UntrackedHUDs, ToKB(Stats.UntrackedHUDBytes), Stats.UntrackedPawns, ToKB(Stats.UntrackedPawnBytes),
+				Args.Contains(TEXT("Gc")) ? TEXT("") : TEXT(" (run with Gc to rule out pending garbage)"));
+		}
+		else
+		{
+			UE_LOG(LogViewportManager, Display, TEXT("  Untracked: none"));
+		}
+	}
+
+	static FAutoConsoleCommand MemReportCommand(
+		TEXT("vm.MemReport"),
+		TEXT("Lists each pane's pawn and HUD with estimated memory, layout data, HUD and pawn pool occupancy, and pane-class widgets or pawns that nothing tracks. ")
+		TEXT("Usage: vm.MemReport [Gc]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunMemReport));
+}
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,188 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMMirrorPanes.h"
+#include "VMViewPanes.h"
+#include "CanvasItem.h"
+#include "Engine/Canvas.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "RHICommandList.h"
+#include "RenderingThread.h"
+#include "TextureResource.h"
+#include "UnrealClient.h"
+#include "VMLog.h"
+
+int32 FVMMirrorPaneSet::FindSourcePane(const UVMSplitLayoutAsset& Layout, const FVMSplitPane& MirrorPane)
+{
+	return Layout.Panes.IndexOfByPredicate([&MirrorPane](const FVMSplitPane& Candidate)
+	{
+		return &Candidate != &MirrorPane && Candidate.LocalPlayerIndex == MirrorPane.MirrorSourcePlayerIndex
+			&& !Candidate.bUIOnly && !Candidate.bMirror;
+	});
+}
+
+void FVMMirrorPaneSet::Rebuild(const UVMSplitLayoutAsset& Layout)
+{
+	Instances.Reset();
+
+	TSet<int32> MirroredPlayers;
+	for (int32 PaneIndex = 0; PaneIndex < Layout.Panes.Num(); ++PaneIndex)
+	{
+		const FVMSplitPane& Pane = Layout.Panes[PaneIndex];
+		if (!Pane.bMirror)
+		{
+			continue;
+		}
+
+		const int32 SourcePaneIndex = FindSourcePane(Layout, Pane);
+		if (SourcePaneIndex == INDEX_NONE)
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("Mirror pane %d has no player or view-only pane with LocalPlayerIndex %d to mirror"),
+				Pane.LocalPlayerIndex, Pane.MirrorSourcePlayerIndex);
+			continue;
+		}
+
+		FVMMirrorPaneInstance& Instance = Instances.AddDefaulted_GetRef();
+		Instance.PaneIndex = PaneIndex;
+		Instance.SourcePaneIndex = SourcePaneIndex;
+
+		if (!Layout.Panes[SourcePaneIndex].bViewOnly)
+		{
+			MirroredPlayers.Add(Pane.MirrorSourcePlayerIndex);
+		}
+	}
+
+	for (auto It = PlayerViewCopies.CreateIterator(); It; ++It)
+	{
+		if (!MirroredPlayers.Contains(It.Key()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	UE_LOG(LogVMLayout, Verbose, TEXT("Mirror panes rebuilt: %d active"), Instances.Num());
+}
+
+void FVMMirrorPaneSet::Reset()
+{
+	Instances.Reset();
+	PlayerViewCopies.Reset();
+}
+
+void FVMMirrorPaneSet::Draw(UCanvas* Canvas, FViewport* Viewport, const UVMSplitLayoutAsset& Layout, const FVMViewPaneSet& ViewPanes,
+	TFunctionRef<bool(int32 LocalPlayerIndex, FVMSplitRect& OutRect)> GetPlayerRect)
+{
+	const FIntPoint CanvasSize(FMath::RoundToInt(Canvas->ClipX), FMath::RoundToInt(Canvas->ClipY));
+
+	// Several mirrors of one player share a single copy per frame
+	TMap<int32, UTextureRenderTarget2D*, TInlineSetAllocator<4>> CopiedThisFrame;
+
+	for (const FVMMirrorPaneInstance& Instance : Instances)
+	{
+		if (!Layout.Panes.IsValidIndex(Instance.PaneIndex) || !Layout.Panes.IsValidIndex(Instance.SourcePaneIndex))
+		{
+			continue;
+		}
+
+		const FVMSplitPane& Pane = Layout.Panes[Instance.PaneIndex];
+		const FVMSplitPane& Source = Layout.Panes[Instance.SourcePaneIndex];
+
+		UTextureRenderTarget2D* Texture = nullptr;
+		if (Source.bViewOnly)
+		{
+			Texture = ViewPanes.FindRenderTarget(Instance.SourcePaneIndex);
+		}
+		else if (UTextureRenderTarget2D** Copied = CopiedThisFrame.Find(Source.LocalPlayerIndex))
+		{
+			Texture = *Copied;
+		}
+		else
+		{
+			FVMSplitRect SourceRect;
+			if (Viewport && GetPlayerRect(Source.LocalPlayerIndex, SourceRect))
+			{
+				const FIntPoint Min(FMath::RoundToInt(SourceRect.Origin01.X * CanvasSize.X), FMath::RoundToInt(SourceRect.Origin01.Y * CanvasSize.Y));
+				const FIntPoint Max(FMath::RoundToInt((SourceRect.Origin01.X + SourceRect.Size01.X) * CanvasSize.X),
+					FMath::RoundToInt((SourceRect.Origin01.Y + SourceRect.Size01.Y) * CanvasSize.Y));
+
+				FIntRect PixelRect(Min, Max);
+				PixelRect.Clip(FIntRect(FIntPoint::ZeroValue, Viewport->GetSizeXY()));
+				if (PixelRect.Area() > 0)
+				{
+					Texture = CopyPlayerView(Viewport, Source.LocalPlayerIndex, PixelRect);
+				}
+			}
+			CopiedThisFrame.Add(Source.LocalPlayerIndex, Texture);
+		}
+
+		const FTextureResource* Resource = Texture ? Texture->GetResource() : nullptr;
+		if (!Resource)
+		{
+			continue;
+		}
+
+		const FVector2D Position(Pane.Rect.Origin01.X * CanvasSize.X, Pane.Rect.Origin01.Y * CanvasSize.Y);
+		const FVector2D Size(Pane.Rect.Size01.X * CanvasSize.X, Pane.Rect.Size01.Y * CanvasSize.Y);
+
+		FCanvasTileItem Tile(Position, Resource, Size, FLinearColor::White);
+		Tile.BlendMode = SE_BLEND_Opaque;
+		Canvas->DrawItem(Tile);
+	}
+}
+
+UTextureRenderTarget2D* FVMMirrorPaneSet::CopyPlayerView(FViewport* Viewport, int32 LocalPlayerIndex, const FIntRect& SourceRect)
+{
+	TObjectPtr<UTextureRenderTarget2D>& Copy = PlayerViewCopies.FindOrAdd(LocalPlayerIndex);
+	const FIntPoint Size = SourceRect.Size();
+
+	if (!Copy)
+	{
+		Copy = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+		Copy->ClearColor = FLinearColor::Black;
+
+		// Matches the game viewport's back buffer so the copy is a plain texture copy; linear so the canvas does not re-apply gamma
+		Copy->InitCustomFormat(Size.X, Size.Y, PF_B8G8R8A8, true);
+	}
+	else if (Copy->SizeX != Size.X || Copy->SizeY != Size.Y)
+	{
+		Copy->ResizeTarget(Size.X, Size.Y);
+	}
+
+	FTextureRenderTargetResource* CopyResource = Copy->GameThread_GetRenderTargetResource();
+	if (!CopyResource)
+	{
+		return nullptr;
+	}
+
+	ENQUEUE_RENDER_COMMAND(VMCopyMirroredPlayerView)([Viewport, CopyResource, SourceRect](FRHICommandListImmediate& RHICmdList)
+	{
+		FRHITexture* SourceTexture = Viewport->GetRenderTargetTexture();
+		FRHITexture* DestTexture = CopyResource->GetRenderTargetTexture();
+		if (!SourceTexture || !DestTexture)
+		{
+			return;
+		}
+
+		if (SourceTexture->GetFormat() != DestTexture->GetFormat())
+		{
+			UE_LOG(LogVMLayout, Verbose, TEXT("Mirror pane source format %d differs from copy format %d; skipping copy"),
+				static_cast<int32>(SourceTexture->GetFormat()), static_cast<int32>(DestTexture->GetFormat()));
+			return;
+		}
+
+		FRHICopyTextureInfo CopyInfo;
+		CopyInfo.SourcePosition = FIntVector(SourceRect.Min.X, SourceRect.Min.Y, 0);
+		CopyInfo.Size = FIntVector(SourceRect.Width(), SourceRect.Height(), 1);
+
+		RHICmdList.Transition({
+			FRHITransitionInfo(SourceTexture, ERHIAccess::Unknown, ERHIAccess::CopySrc),
+			FRHITransitionInfo(DestTexture, ERHIAccess::Unknown, ERHIAccess::CopyDest)
+		});
+		RHICmdList.CopyTexture(SourceTexture, DestTexture, CopyInfo);
+		RHICmdList.Transition({
+			FRHITransitionInfo(SourceTexture, ERHIAccess::CopySrc, ERHIAccess::RTV),
+			FRHITransitionInfo(DestTexture, ERHIAccess::CopyDest, ERHIAccess::SRVMask)
+		});
+	});
+
+	return Copy;
+}
@@ -0,0 +1,258 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMPaneCosts.h"
+
+#if VM_WITH_PANE_COSTS
+
+#include "HAL/IConsoleManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Level.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "VMLog.h"
+
+bool FVMPaneCosts::bEnabled = false;
+bool FVMPaneCosts::bOverlayVisible = false;
+TArray<FVMPaneCosts::FPane> FVMPaneCosts::Panes;
+double FVMPaneCosts::WindowStartSeconds = 0.0;
+int32 FVMPaneCosts::WindowFrames = 0;
+uint64 FVMPaneCosts::LastEndedFrame = 0;
+
+float FVMPaneCosts::FPane::GetTotalMs() const
+{
+	float TotalMs = 0.0f;
+	for (const float CostMs : AverageMs)
+	{
+		TotalMs += CostMs;
+	}
+	return TotalMs;
+}
+
+void FVMPaneCosts::SetEnabled(bool bInEnabled)
+{
+	if (bInEnabled && !bEnabled)
+	{
+		Panes.Reset();
+		WindowStartSeconds = FPlatformTime::Seconds();
+		WindowFrames = 0;
+	}
+
+	bEnabled = bInEnabled;
+	bOverlayVisible &= bInEnabled;
+}
+
+void FVMPaneCosts::SetOverlayVisible(bool bVisible)
+{
+	if (bVisible)
+	{
+		SetEnabled(true);
+	}
+	bOverlayVisible = bVisible;
+}
+
+void FVMPaneCosts::Add(int32 LocalPlayerIndex, EVMPaneCost Cost, double Seconds)
+{
+	if (LocalPlayerIndex < 0)
+	{
+		return;
+	}
+
+	if (!Panes.IsValidIndex(LocalPlayerIndex))
+	{
+		Panes.SetNum(LocalPlayerIndex + 1);
+	}
+	Panes[LocalPlayerIndex].FrameSeconds[static_cast<int32>(Cost)] += Seconds;
+}
+
+void FVMPaneCosts::EndFrame()
+{
+	if (!bEnabled || LastEndedFrame == GFrameCounter)
+	{
+		return;
+	}
+	LastEndedFrame = GFrameCounter;
+	++WindowFrames;
+
+	for (FPane& Pane : Panes)
+	{
+		double FrameTotal = 0.0;
+		for (int32 Cost = 0; Cost < NumCosts; ++Cost)
+		{
+			FrameTotal += Pane.FrameSeconds[Cost];
+			Pane.WindowSeconds[Cost] += Pane.FrameSeconds[Cost];
+			Pane.FrameSeconds[Cost] = 0.0;
+		}
+		Pane.WindowPeakSeconds = FMath::Max(Pane.WindowPeakSeconds, FrameTotal);
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now - WindowStartSeconds < 1.0)
+	{
+		return;
+	}
+
+	for (FPane& Pane : Panes)
+	{
+		for (int32 Cost = 0; Cost < NumCosts; ++Cost)
+		{
+			Pane.AverageMs[Cost] = static_cast<float>(Pane.WindowSeconds[Cost] * 1000.0 / WindowFrames);
+			Pane.WindowSeconds[Cost] = 0.0;
+		}
+		Pane.PeakMs = static_cast<float>(Pane.WindowPeakSeconds * 1000.0);
+		Pane.WindowPeakSeconds = 0.0;
+	}
+
+	WindowStartSeconds = Now;
+	WindowFrames = 0;
+}
+
+const FVMPaneCosts::FPane* FVMPaneCosts::Find(int32 LocalPlayerIndex)
+{
+	return Panes.IsValidIndex(LocalPlayerIndex) ? &Panes[LocalPlayerIndex] : nullptr;
+}
+
+int32 FVMPaneCosts::FindLocalPlayerIndex(const APawn* Pawn)
+{
+	const APlayerController* PC = Pawn ? Pawn->GetController<APlayerController>() : nullptr;
+	const ULocalPlayer* LocalPlayer = PC ? PC->GetLocalPlayer() : nullptr;
+	const UGameInstance* GameInstance = LocalPlayer ? LocalPlayer->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetLocalPlayers().IndexOfByKey(LocalPlayer) : INDEX_NONE;
+}
+
+FVMControllerTickTimer::FVMControllerTickTimer(UObject* InOwner, APlayerController* InController, int32 InLocalPlayerIndex)
+	: Owner(InOwner)
+	, Controller(InController)
+	, LocalPlayerIndex(InLocalPlayerIndex)
+{
+	for (FMark* Mark : { &StartMark, &EndMark })
+	{
+		Mark->Timer = this;
+		Mark->bCanEverTick = true;
+		Mark->bStartWithTickEnabled = true;
+		Mark->TickGroup = InController->PrimaryActorTick.TickGroup;
+		Mark->EndTickGroup = InController->PrimaryActorTick.TickGroup;
+		Mark->RegisterTickFunction(InController->GetLevel());
+	}
+
+	// The end mark runs as soon as the controller finishes, so only the start can be early
+	StartMark.bStart = true;
+	EndMark.bHighPriority = true;
+
+	InController->PrimaryActorTick.AddPrerequisite(InOwner, StartMark);
+	EndMark.AddPrerequisite(InController, InController->PrimaryActorTick);
+}
+
+FVMControllerTickTimer::~FVMControllerTickTimer()
+{
+	if (APlayerController* PC = Controller.Get())
+	{
+		PC->PrimaryActorTick.RemovePrerequisite(Owner, StartMark);
+	}
+
+	// A level that was torn down has already unregistered both
+	for (FMark* Mark : { &StartMark, &EndMark })
+	{
+		if (Mark->IsTickFunctionRegistered())
+		{
+			Mark->UnRegisterTickFunction();
+		}
+	}
+}
+
+void FVMControllerTickTimer::OnMark(bool bStart)
+{
+	if (bStart)
+	{
+		StartCycles = FPlatformTime::Cycles64();
+		StartFrame = GFrameCounter;
+		return;
+	}
+
+	// Throttled or dormant controllers skip their tick; the marks still run, with nothing in between
+	const APlayerController* PC = Controller.Get();
+	if (StartFrame == GFrameCounter && PC && PC->PrimaryActorTick.IsTickFunctionEnabled())
+	{
+		FVMPaneCosts::Add(LocalPlayerIndex, EVMPaneCost::Controller, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+	}
+}
+
+void FVMControllerTickTimer::FMark::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	Timer->OnMark(bStart);
+}
+
+FString FVMControllerTickTimer::FMark::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("FVMControllerTickTimer[LP%d %s]"), Timer->LocalPlayerIndex, bStart ? TEXT("Start") : TEXT("End"));
+}
+
+const TCHAR* FVMPaneCosts::GetCostName(EVMPaneCost Cost)
+{
+	switch (Cost)
+	{
+	case EVMPaneCost::Controller: return TEXT("Controller");
+	case EVMPaneCost::Pawn: return TEXT("Pawn");
+	case EVMPaneCost::HUD: return TEXT("HUD");
+	case EVMPaneCost::Input: return TEXT("Input");
+	default: return TEXT("Unknown");
+	}
+}
+
+namespace VMPaneCostCommands
+{
+	static void DumpPaneStats()
+	{
+		if (FVMPaneCosts::GetNumPanes() == 0)
+		{
+			UE_LOG(LogViewportManager, Display, TEXT("vm.PaneStats - No pane has been attributed any time yet"));
+			return;
+		}
+
+		UE_LOG(LogViewportManager, Display, TEXT("vm.PaneStats - Game-thread ms per frame, averaged over the last second:"));
+		for (int32 LocalPlayerIndex = 0; LocalPlayerIndex < FVMPaneCosts::GetNumPanes(); ++LocalPlayerIndex)
+		{
+			const FVMPaneCosts::FPane* Pane = FVMPaneCosts::Find(LocalPlayerIndex);
+
+			FString Breakdown;
+			for (int32 Cost = 0; Cost < FVMPaneCosts::NumCosts; ++Cost)
+			{
+				Breakdown += FString::Printf(TEXT("  %s %.3f"), FVMPaneCosts::GetCostName(static_cast<EVMPaneCost>(Cost)), Pane->AverageMs[Cost]);
+			}
+
+			UE_LOG(LogViewportManager, Display, TEXT("  LP%d: total %.3f (peak %.3f)%s"), LocalPlayerIndex, Pane->GetTotalMs(), Pane->PeakMs, *Breakdown);
+		}
+	}
+
+	static void RunPaneStats(const TArray<FString>& Args)
+	{
+		const FString Mode = Args.Num() > 0 ? Args[0] : FString();
+		if (Mode.Equals(TEXT("Off"), ESearchCase::IgnoreCase))
+		{
+			FVMPaneCosts::SetEnabled(false);
+			UE_LOG(LogViewportManager, Display, TEXT("vm.PaneStats - Collection stopped"));
+		}
+		else if (Mode.Equals(TEXT("Overlay"), ESearchCase::IgnoreCase))
+		{
+			FVMPaneCosts::SetOverlayVisible(!FVMPaneCosts::IsOverlayVisible());
+			UE_LOG(LogViewportManager, Display, TEXT("vm.PaneStats - Overlay %s"), FVMPaneCosts::IsOverlayVisible() ? TEXT("shown") : TEXT("hidden"));
+		}
+		else if (!FVMPaneCosts::IsEnabled())
+		{
+			FVMPaneCosts::SetEnabled(true);
+			UE_LOG(LogViewportManager, Display, TEXT("vm.PaneStats - Collection started; run again after a second for numbers"));
+		}
+		else
+		{
+			DumpPaneStats();
+		}
+	}
+
+	static FAutoConsoleCommand PaneStatsCommand(
+		TEXT("vm.PaneStats"),
+		TEXT("Reports game-thread time per pane, split into controller, pawn, HUD and input. The first call starts collection. ")
+		TEXT("Usage: vm.PaneStats [Overlay|Off]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&RunPaneStats));
+}
+
+#endif // VM_WITH_PANE_COSTS
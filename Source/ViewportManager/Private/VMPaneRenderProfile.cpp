@@ -0,0 +1,61 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMPaneRenderProfile.h"
+#include "SceneView.h"
+#include "ShowFlags.h"
+#include "VMLog.h"
+
+void UVMPaneRenderProfile::ApplyShowFlags(FEngineShowFlags& ShowFlags) const
+{
+	for (const FEngineShowFlagsSetting& Setting : ShowFlagOverrides)
+	{
+		const int32 FlagIndex = FEngineShowFlags::FindIndexByName(*Setting.ShowFlagName);
+		if (FlagIndex == INDEX_NONE)
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("Render profile '%s' overrides unknown show flag '%s'"), *GetName(), *Setting.ShowFlagName);
+			continue;
+		}
+
+		ShowFlags.SetSingleFlag(FlagIndex, Setting.Enabled);
+	}
+}
+
+void UVMPaneRenderProfile::ApplyToView(FSceneView& View) const
+{
+	View.LODDistanceFactor *= LODDistanceFactor;
+
+	if (PostProcessBlendWeight > 0.0f)
+	{
+		View.OverridePostProcessSettings(PostProcessSettings, PostProcessBlendWeight);
+	}
+}
+
+TArray<FEngineShowFlagsSetting> UVMPaneRenderProfile::GetSharedShowFlagOverrides(TConstArrayView<const UVMPaneRenderProfile*> Profiles)
+{
+	TArray<FEngineShowFlagsSetting> Shared;
+	if (Profiles.Num() == 0 || !Profiles[0])
+	{
+		return Shared;
+	}
+
+	Shared = Profiles[0]->ShowFlagOverrides;
+	for (int32 i = 1; i < Profiles.Num() && Shared.Num() > 0; ++i)
+	{
+		if (!Profiles[i])
+		{
+			Shared.Reset();
+			break;
+		}
+
+		const TArray<FEngineShowFlagsSetting>& Overrides = Profiles[i]->ShowFlagOverrides;
+		Shared.RemoveAll([&Overrides](const FEngineShowFlagsSetting& Setting)
+		{
+			return !Overrides.ContainsByPredicate([&Setting](const FEngineShowFlagsSetting& Other)
+			{
+				return Other.ShowFlagName == Setting.ShowFlagName && Other.Enabled == Setting.Enabled;
+			});
+		});
+	}
+
+	return Shared;
+}
@@ -0,0 +1,72 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMPaneResolution.h"
+#include "VMViewportManagerSettings.h"
+
+void FVMPaneResolution::ComputeScales(TConstArrayView<FVMSplitPane> Panes, const FIntPoint& ViewportSize, float PixelBudgetMegapixels, TArray<float>& OutScales)
+{
+	OutScales.Init(1.0f, Panes.Num());
+
+	const double ViewportPixels = static_cast<double>(FMath::Max(ViewportSize.X, 1)) * FMath::Max(ViewportSize.Y, 1);
+
+	float LargestArea = 0.0f;
+	double BudgetedPixels = 0.0;
+	for (const FVMSplitPane& Pane : Panes)
+	{
+		// UI-only and mirror panes render no scene of their own
+		if (Pane.bUIOnly || Pane.bMirror)
+		{
+			continue;
+		}
+
+		const float Area = Pane.Rect.Size01.X * Pane.Rect.Size01.Y;
+		LargestArea = FMath::Max(LargestArea, Area);
+		if (Pane.ResolutionPolicy == EVMPaneResolutionPolicy::PixelBudget)
+		{
+			BudgetedPixels += Area * ViewportPixels;
+		}
+	}
+
+	// One uniform scale for every budgeted pane keeps their pixel density equal
+	const double BudgetPixels = FMath::Max(PixelBudgetMegapixels, 0.0f) * 1.0e6;
+	const float BudgetScale = BudgetedPixels > BudgetPixels && BudgetedPixels > 0.0
+		? static_cast<float>(FMath::Sqrt(BudgetPixels / BudgetedPixels))
+		: 1.0f;
+
+	for (int32 i = 0; i < Panes.Num(); ++i)
+	{
+		const FVMSplitPane& Pane = Panes[i];
+		if (Pane.bUIOnly || Pane.bMirror)
+		{
+			continue;
+		}
+
+		float Scale = 1.0f;
+		switch (Pane.ResolutionPolicy)
+		{
+		case EVMPaneResolutionPolicy::FixedScale:
+			Scale = Pane.ResolutionScale;
+			break;
+		case EVMPaneResolutionPolicy::AreaProportional:
+			// The largest pane stays native; smaller panes keep pixel count proportional to their area
+			Scale = LargestArea > 0.0f ? FMath::Sqrt((Pane.Rect.Size01.X * Pane.Rect.Size01.Y) / LargestArea) : 1.0f;
+			break;
+		case EVMPaneResolutionPolicy::PixelBudget:
+			Scale = BudgetScale;
+			break;
+		case EVMPaneResolutionPolicy::Native:
+		default:
+			break;
+		}
+
+		OutScales[i] = Pane.ResolutionPolicy == EVMPaneResolutionPolicy::Native
+			? 1.0f
+			: FMath::Clamp(Scale, FMath::Clamp(Pane.MinResolutionScale, 0.01f, 1.0f), 1.0f);
+	}
+}
+
+void FVMPaneResolution::ComputeScales(TConstArrayView<FVMSplitPane> Panes, const FIntPoint& ViewportSize, TArray<float>& OutScales)
+{
+	const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>();
+	ComputeScales(Panes, ViewportSize, Settings ? Settings->PanePixelBudgetMegapixels : 8.3f, OutScales);
+}
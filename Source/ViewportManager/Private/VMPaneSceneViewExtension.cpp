@@ -0,0 +1,44 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMPaneSceneViewExtension.h"
+#include "VMGameViewportClient.h"
+#include "VMPaneRenderProfile.h"
+#include "SceneView.h"
+
+FVMPaneSceneViewExtension::FVMPaneSceneViewExtension(const FAutoRegister& AutoRegister, UVMGameViewportClient* InViewportClient)
+	: FSceneViewExtensionBase(AutoRegister)
+	, ViewportClient(InViewportClient)
+{
+}
+
+bool FVMPaneSceneViewExtension::IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const
+{
+	const UVMGameViewportClient* Client = ViewportClient.Get();
+	return Client && Client->HasRenderProfiles() && Context.Viewport && Context.Viewport == Client->Viewport;
+}
+
+void FVMPaneSceneViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
+{
+	if (const UVMGameViewportClient* Client = ViewportClient.Get())
+	{
+		for (const FEngineShowFlagsSetting& Setting : Client->GetSharedRenderShowFlags())
+		{
+			const int32 FlagIndex = FEngineShowFlags::FindIndexByName(*Setting.ShowFlagName);
+			if (FlagIndex != INDEX_NONE)
+			{
+				InViewFamily.EngineShowFlags.SetSingleFlag(FlagIndex, Setting.Enabled);
+			}
+		}
+	}
+}
+
+void FVMPaneSceneViewExtension::SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView)
+{
+	if (const UVMGameViewportClient* Client = ViewportClient.Get())
+	{
+		if (const UVMPaneRenderProfile* Profile = Client->FindRenderProfileForController(InView.PlayerIndex))
+		{
+			Profile->ApplyToView(InView);
+		}
+	}
+}
@@ -0,0 +1,28 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SceneViewExtension.h"
+
+class UVMGameViewportClient;
+
+/**
+ * Applies pane render profiles to the game viewport's view family and to each player's
+ * scene view. Inactive for any other viewport and for scene captures.
+ */
+class FVMPaneSceneViewExtension : public FSceneViewExtensionBase
+{
+public:
+	FVMPaneSceneViewExtension(const FAutoRegister& AutoRegister, UVMGameViewportClient* InViewportClient);
+
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override;
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override;
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+
+protected:
+	virtual bool IsActiveThisFrame_Internal(const FSceneViewExtensionContext& Context) const override;
+
+private:
+	TWeakObjectPtr<UVMGameViewportClient> ViewportClient;
+};
@@ -0,0 +1,113 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMPawnPool.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "VMCameraPawn.h"
+#include "VMLog.h"
+
+APawn* FVMPawnPool::Acquire(TSubclassOf<APawn> PawnClass, UWorld* World, const FTransform& SpawnTransform)
+{
+	TArray<TWeakObjectPtr<APawn>>* Bucket = Buckets.Find(PawnClass.Get());
+	if (!Bucket)
+	{
+		return nullptr;
+	}
+
+	for (int32 i = Bucket->Num() - 1; i >= 0; --i)
+	{
+		APawn* Pawn = (*Bucket)[i].Get();
+		if (!IsValid(Pawn) || Pawn->GetWorld() != World)
+		{
+			Bucket->RemoveAtSwap(i);
+			continue;
+		}
+
+		Bucket->RemoveAtSwap(i);
+		Pawn->SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+		SetPawnParked(Pawn, false);
+
+		++Stats.Reuses;
+		return Pawn;
+	}
+
+	return nullptr;
+}
+
+bool FVMPawnPool::Park(APawn* Pawn, int32 MaxIdlePerClass)
+{
+	if (!IsValid(Pawn) || Pawn->IsPendingKillPending())
+	{
+		return false;
+	}
+
+	TArray<TWeakObjectPtr<APawn>>& Bucket = Buckets.FindOrAdd(Pawn->GetClass());
+	Bucket.RemoveAllSwap([](const TWeakObjectPtr<APawn>& Entry) { return !Entry.IsValid(); });
+
+	if (Bucket.Num() >= MaxIdlePerClass)
+	{
+		++Stats.Evicted;
+		UE_LOG(LogVMLayout, Verbose, TEXT("Pawn pool full for %s; destroying pawn"), *Pawn->GetClass()->GetName());
+		return false;
+	}
+
+	SetPawnParked(Pawn, true);
+	Bucket.Add(Pawn);
+	++Stats.Parked;
+	return true;
+}
+
+FVMPawnPoolStats FVMPawnPool::GetStats() const
+{
+	FVMPawnPoolStats Result = Stats;
+	Result.IdlePawns = 0;
+	for (const auto& Pair : Buckets)
+	{
+		for (const TWeakObjectPtr<APawn>& Entry : Pair.Value)
+		{
+			Result.IdlePawns += Entry.IsValid() ? 1 : 0;
+		}
+	}
+	return Result;
+}
+
+void FVMPawnPool::GetIdlePawns(TArray<APawn*>& OutPawns) const
+{
+	for (const auto& Pair : Buckets)
+	{
+		for (const TWeakObjectPtr<APawn>& Entry : Pair.Value)
+		{
+			if (APawn* Pawn = Entry.Get())
+			{
+				OutPawns.Add(Pawn);
+			}
+		}
+	}
+}
+
+void FVMPawnPool::SetPawnParked(APawn* Pawn, bool bParked)
+{
+	Pawn->SetActorHiddenInGame(bParked);
+	Pawn->SetActorEnableCollision(!bParked);
+
+	// Restore the class defaults rather than forcing ticks on, so components that never tick stay idle
+	Pawn->SetActorTickEnabled(!bParked && Pawn->PrimaryActorTick.bStartWithTickEnabled);
+	Pawn->ForEachComponent(false, [bParked](UActorComponent* Component)
+	{
+		Component->SetComponentTickEnabled(!bParked && Component->PrimaryComponentTick.bStartWithTickEnabled);
+	});
+
+	if (bParked)
+	{
+		Pawn->DisableInput(nullptr);
+	}
+	else
+	{
+		Pawn->EnableInput(nullptr);
+	}
+
+	if (AVMCameraPawn* CameraPawn = Cast<AVMCameraPawn>(Pawn))
+	{
+		CameraPawn->SetCameraAsleep(bParked);
+	}
+}
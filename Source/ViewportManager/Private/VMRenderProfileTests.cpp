@@ -0,0 +1,181 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "SceneView.h"
+#include "SceneViewExtension.h"
+#include "ShowFlags.h"
+#include "UObject/Package.h"
+#include "VMGameViewportClient.h"
+#include "VMPaneRenderProfile.h"
+#include "VMSplitLayoutAsset.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMRenderProfileTests
+{
+	static UVMPaneRenderProfile* CreateProfile(std::initializer_list<const TCHAR*> DisabledFlags)
+	{
+		UVMPaneRenderProfile* Profile = NewObject<UVMPaneRenderProfile>();
+		for (const TCHAR* FlagName : DisabledFlags)
+		{
+			FEngineShowFlagsSetting& Setting = Profile->ShowFlagOverrides.AddDefaulted_GetRef();
+			Setting.ShowFlagName = FlagName;
+			Setting.Enabled = false;
+		}
+		return Profile;
+	}
+
+	static bool ContainsOverride(const TArray<FEngineShowFlagsSetting>& Overrides, const TCHAR* FlagName)
+	{
+		return Overrides.ContainsByPredicate([FlagName](const FEngineShowFlagsSetting& Setting)
+		{
+			return Setting.ShowFlagName == FlagName;
+		});
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMRenderProfileShowFlagsTest, "ViewportManager.RenderProfiles.ShowFlags",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVMRenderProfileShowFlagsTest::RunTest(const FString& Parameters)
+{
+	using namespace VMRenderProfileTests;
+
+	// A typical picture-in-picture tier: no dynamic shadows, motion blur or volumetric fog
+	const UVMPaneRenderProfile* PiPProfile = CreateProfile({ TEXT("DynamicShadows"), TEXT("MotionBlur"), TEXT("VolumetricFog") });
+
+	FEngineShowFlags Flags(ESFIM_Game);
+	TestTrue(TEXT("Game show flags start with dynamic shadows"), Flags.DynamicShadows != 0);
+
+	PiPProfile->ApplyShowFlags(Flags);
+	TestFalse(TEXT("Profile disables dynamic shadows"), Flags.DynamicShadows != 0);
+	TestFalse(TEXT("Profile disables motion blur"), Flags.MotionBlur != 0);
+	TestFalse(TEXT("Profile disables volumetric fog"), Flags.VolumetricFog != 0);
+	TestTrue(TEXT("Profile leaves unlisted flags untouched"), Flags.PostProcessing != 0);
+
+	// Player panes share one view family, so only overrides every pane agrees on reach it
+	const UVMPaneRenderProfile* ShadowlessProfile = CreateProfile({ TEXT("DynamicShadows"), TEXT("Bloom") });
+
+	const TArray<FEngineShowFlagsSetting> Shared = UVMPaneRenderProfile::GetSharedShowFlagOverrides({ PiPProfile, ShadowlessProfile });
+	TestEqual(TEXT("Shared overrides are the intersection"), Shared.Num(), 1);
+	TestTrue(TEXT("Shared overrides keep DynamicShadows"), ContainsOverride(Shared, TEXT("DynamicShadows")));
+
+	const TArray<FEngineShowFlagsSetting> SharedWithDefault = UVMPaneRenderProfile::GetSharedShowFlagOverrides({ PiPProfile, nullptr });
+	TestEqual(TEXT("A pane without a profile keeps the family at defaults"), SharedWithDefault.Num(), 0);
+
+	return true;
+}
+
+/**
+ * Renders one frame's worth of views the way UGameViewportClient::Draw sets them up, so the
+ * profiles reach the family and each player's view through FVMPaneSceneViewExtension.
+ * Needs a running game whose viewport client is UVMGameViewportClient with a player layout applied.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMRenderProfileSceneViewTest, "ViewportManager.RenderProfiles.SceneViewExtension",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FVMRenderProfileSceneViewTest::RunTest(const FString& Parameters)
+{
+	using namespace VMRenderProfileTests;
+
+	UVMGameViewportClient* Client = GEngine ? Cast<UVMGameViewportClient>(GEngine->GameViewport) : nullptr;
+	UVMSplitLayoutAsset* OriginalLayout = Client ? Client->GetCurrentLayout() : nullptr;
+	UGameInstance* GameInstance = Client ? Client->GetGameInstance() : nullptr;
+	if (!OriginalLayout || !GameInstance || !Client->Viewport || !Client->GetWorld())
+	{
+		AddError(TEXT("Needs a running game using UVMGameViewportClient with a layout applied"));
+		return false;
+	}
+
+	UVMPaneRenderProfile* PiPProfile = CreateProfile({ TEXT("DynamicShadows"), TEXT("MotionBlur") });
+	PiPProfile->LODDistanceFactor = 2.0f;
+	PiPProfile->PostProcessBlendWeight = 1.0f;
+	PiPProfile->PostProcessSettings.bOverride_BloomIntensity = true;
+	PiPProfile->PostProcessSettings.BloomIntensity = 0.25f;
+
+	UVMPaneRenderProfile* ShadowlessProfile = CreateProfile({ TEXT("DynamicShadows"), TEXT("Bloom") });
+	ShadowlessProfile->LODDistanceFactor = 1.5f;
+
+	// Same panes, so this is an incremental apply that only swaps the rendering settings
+	UVMSplitLayoutAsset* ProfiledLayout = DuplicateObject(OriginalLayout, GetTransientPackage());
+	TMap<int32, const UVMPaneRenderProfile*> ProfileByPlayer;
+	for (FVMSplitPane& Pane : ProfiledLayout->Panes)
+	{
+		if (Pane.NeedsLocalPlayer())
+		{
+			Pane.RenderProfile = (ProfileByPlayer.Num() % 2) ? ShadowlessProfile : PiPProfile;
+			ProfileByPlayer.Add(Pane.LocalPlayerIndex, Pane.RenderProfile);
+		}
+	}
+
+	if (ProfileByPlayer.Num() == 0)
+	{
+		AddError(TEXT("The current layout has no player panes"));
+		return false;
+	}
+
+	Client->ApplyLayout(ProfiledLayout);
+	TestTrue(TEXT("Client reports render profiles"), Client->HasRenderProfiles());
+
+	{
+		FSceneViewFamilyContext ViewFamily(FSceneViewFamily::ConstructionValues(Client->Viewport, Client->GetWorld()->Scene, Client->EngineShowFlags)
+			.SetRealtimeUpdate(true));
+		ViewFamily.ViewExtensions = GEngine->ViewExtensions->GatherActiveExtensions(FSceneViewExtensionContext(Client->Viewport));
+
+		for (const TSharedRef<ISceneViewExtension, ESPMode::ThreadSafe>& Extension : ViewFamily.ViewExtensions)
+		{
+			Extension->SetupViewFamily(ViewFamily);
+		}
+
+		// DynamicShadows is the only flag both profiles turn off; Bloom is off in one of them only
+		TestFalse(TEXT("Family has the shared DynamicShadows override"), ViewFamily.EngineShowFlags.DynamicShadows != 0);
+		TestEqual(TEXT("Family keeps flags only some panes override"), ViewFamily.EngineShowFlags.Bloom != 0, Client->EngineShowFlags.Bloom != 0);
+
+		int32 NumViews = 0;
+		const TArray<ULocalPlayer*>& LocalPlayers = GameInstance->GetLocalPlayers();
+		for (int32 LocalPlayerIndex = 0; LocalPlayerIndex < LocalPlayers.Num(); ++LocalPlayerIndex)
+		{
+			const UVMPaneRenderProfile* const* Expected = ProfileByPlayer.Find(LocalPlayerIndex);
+			if (!Expected || !LocalPlayers[LocalPlayerIndex])
+			{
+				continue;
+			}
+
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			FSceneView* View = LocalPlayers[LocalPlayerIndex]->CalcSceneView(&ViewFamily, ViewLocation, ViewRotation, Client->Viewport);
+			if (!View)
+			{
+				continue;
+			}
+
+			const float LODDistanceFactorBefore = View->LODDistanceFactor;
+			for (const TSharedRef<ISceneViewExtension, ESPMode::ThreadSafe>& Extension : ViewFamily.ViewExtensions)
+			{
+				Extension->SetupView(ViewFamily, *View);
+			}
+
+			const FString Player = FString::Printf(TEXT("Player %d"), LocalPlayerIndex);
+			TestEqual(Player + TEXT(" LOD distance factor"), View->LODDistanceFactor, LODDistanceFactorBefore * (*Expected)->LODDistanceFactor, KINDA_SMALL_NUMBER);
+			if (*Expected == PiPProfile)
+			{
+				TestEqual(Player + TEXT(" post process override"), View->FinalPostProcessSettings.BloomIntensity, 0.25f, KINDA_SMALL_NUMBER);
+			}
+			++NumViews;
+		}
+
+		TestTrue(TEXT("At least one player view was set up"), NumViews > 0);
+	}
+
+	Client->ApplyLayout(OriginalLayout);
+	TestEqual(TEXT("Restoring the layout restores its profile state"), Client->HasRenderProfiles(),
+		OriginalLayout->Panes.ContainsByPredicate([](const FVMSplitPane& Pane) { return Pane.NeedsLocalPlayer() && Pane.RenderProfile; }));
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -23,7 +23,7 @@ bool UVMSplitBlueprintLibrary::ApplyLayout(UVMSplitLayoutAsset* LayoutAsset)
 	if (UVMSplitSubsystem* VMSubsystem = GetVMSplitSubsystem())
 	{
 		VMSubsystem->ApplyLayout(LayoutAsset);
-		UE_LOG(LogViewportManager, Log, TEXT("UVMSplitBlueprintLibrary::ApplyLayout - Applied layout successfully"));
+		UE_LOG(LogViewportManager, Verbose, TEXT("UVMSplitBlueprintLibrary::ApplyLayout - Applied layout successfully"));
 		return true;
 	}
 
@@ -73,7 +73,7 @@ bool UVMSplitBlueprintLibrary::ApplySimple2PlayerLayout(TSubclassOf<UUserWidget>
 	TempLayout->bAutoSpawnPlayers = true;
 
 	VMSubsystem->ApplyLayout(TempLayout);
-	UE_LOG(LogViewportManager, Log, TEXT("UVMSplitBlueprintLibrary::ApplySimple2PlayerLayout - Applied 2-player layout"));
+	UE_LOG(LogViewportManager, Verbose, TEXT("UVMSplitBlueprintLibrary::ApplySimple2PlayerLayout - Applied 2-player layout"));
 	return true;
 }
 
@@ -147,7 +147,7 @@ bool UVMSplitBlueprintLibrary::ApplySimple4PlayerLayout(TSubclassOf<UUserWidget>
 	TempLayout->bAutoSpawnPlayers = true;
 
 	VMSubsystem->ApplyLayout(TempLayout);
-	UE_LOG(LogViewportManager, Log, TEXT("UVMSplitBlueprintLibrary::ApplySimple4PlayerLayout - Applied 4-player layout"));
+	UE_LOG(LogViewportManager, Verbose, TEXT("UVMSplitBlueprintLibrary::ApplySimple4PlayerLayout - Applied 4-player layout"));
 	return true;
 }
 
@@ -172,6 +172,36 @@ bool UVMSplitBlueprintLibrary::IsVMGameViewportClientActive()
 	return false;
 }
 
+bool UVMSplitBlueprintLibrary::SetPaneRects(const TArray<FVMPaneRectEdit>& Edits, FString& OutError)
+{
+	if (UVMSplitSubsystem* VMSubsystem = GetVMSplitSubsystem())
+	{
+		return VMSubsystem->SetPaneRects(Edits, OutError);
+	}
+
+	OutError = TEXT("Could not get VMSplitSubsystem");
+	return false;
+}
+
+void UVMSplitBlueprintLibrary::BeginLayoutEdit()
+{
+	if (UVMSplitSubsystem* VMSubsystem = GetVMSplitSubsystem())
+	{
+		VMSubsystem->BeginLayoutEdit();
+	}
+}
+
+bool UVMSplitBlueprintLibrary::CommitLayoutEdit(FString& OutError)
+{
+	if (UVMSplitSubsystem* VMSubsystem = GetVMSplitSubsystem())
+	{
+		return VMSubsystem->CommitLayoutEdit(OutError);
+	}
+
+	OutError = TEXT("Could not get VMSplitSubsystem");
+	return false;
+}
+
 void UVMSplitBlueprintLibrary::SetActiveKeyboardMousePlayer(int32 LocalPlayerIndex)
 {
 	if (UVMSplitSubsystem* VMSubsystem = GetVMSplitSubsystem())
@@ -216,7 +246,7 @@ void UVMSplitBlueprintLibrary::SetCameraControlsEnabled(int32 LocalPlayerIndex,
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::SetCameraControlsEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::SetCameraControlsEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -237,7 +267,7 @@ void UVMSplitBlueprintLibrary::ToggleCameraControls(int32 LocalPlayerIndex)
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::ToggleCameraControls - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::ToggleCameraControls - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -249,7 +279,7 @@ void UVMSplitBlueprintLibrary::SetOrbitEnabled(int32 LocalPlayerIndex, bool bEna
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::SetOrbitEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::SetOrbitEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -270,7 +300,7 @@ void UVMSplitBlueprintLibrary::ToggleOrbit(int32 LocalPlayerIndex)
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::ToggleOrbit - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::ToggleOrbit - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -282,7 +312,7 @@ void UVMSplitBlueprintLibrary::SetPanEnabled(int32 LocalPlayerIndex, bool bEnabl
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::SetPanEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::SetPanEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -303,7 +333,7 @@ void UVMSplitBlueprintLibrary::TogglePan(int32 LocalPlayerIndex)
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::TogglePan - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::TogglePan - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -315,7 +345,7 @@ void UVMSplitBlueprintLibrary::SetZoomEnabled(int32 LocalPlayerIndex, bool bEnab
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::SetZoomEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::SetZoomEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -336,7 +366,7 @@ void UVMSplitBlueprintLibrary::ToggleZoom(int32 LocalPlayerIndex)
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::ToggleZoom - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::ToggleZoom - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -348,7 +378,7 @@ void UVMSplitBlueprintLibrary::SetTargetActorTrackingEnabled(int32 LocalPlayerIn
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::SetTargetActorTrackingEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::SetTargetActorTrackingEnabled - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -369,7 +399,7 @@ void UVMSplitBlueprintLibrary::ToggleTargetActorTracking(int32 LocalPlayerIndex)
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::ToggleTargetActorTracking - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::ToggleTargetActorTracking - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -381,7 +411,7 @@ void UVMSplitBlueprintLibrary::SetTargetActor(int32 LocalPlayerIndex, AActor* Ta
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::SetTargetActor - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::SetTargetActor - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -402,7 +432,7 @@ void UVMSplitBlueprintLibrary::FocusOnActor(int32 LocalPlayerIndex, AActor* Acto
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitBlueprintLibrary::FocusOnActor - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("UVMSplitBlueprintLibrary::FocusOnActor - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 	}
 }
 
@@ -442,7 +472,7 @@ bool UVMSplitBlueprintLibrary::QuickSetupSplitScreen(int32 NumPlayers, bool bHor
 			TempLayout->bAutoSpawnPlayers = true;
 
 			VMSubsystem->ApplyLayout(TempLayout);
-			UE_LOG(LogViewportManager, Log, TEXT("QuickSetupSplitScreen - Applied 2-player vertical split"));
+			UE_LOG(LogViewportManager, Verbose, TEXT("QuickSetupSplitScreen - Applied 2-player vertical split"));
 			return true;
 		}
 	}
@@ -468,7 +498,7 @@ void UVMSplitBlueprintLibrary::ConfigureCameraControls(int32 LocalPlayerIndex, b
 	AVMCameraPawn* CameraPawn = GetVMCameraPawn(LocalPlayerIndex);
 	if (!CameraPawn)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("ConfigureCameraControls - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("ConfigureCameraControls - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 		return;
 	}
 
@@ -490,7 +520,7 @@ void UVMSplitBlueprintLibrary::ConfigureCameraControls(int32 LocalPlayerIndex, b
 		}
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("ConfigureCameraControls - Player %d: Orbit=%s, Pan=%s, Zoom=%s, Cursor=%s"),
+	UE_LOG(LogViewportManager, Verbose, TEXT("ConfigureCameraControls - Player %d: Orbit=%s, Pan=%s, Zoom=%s, Cursor=%s"),
 		LocalPlayerIndex,
 		bEnableOrbit ? TEXT("ON") : TEXT("OFF"),
 		bEnablePan ? TEXT("ON") : TEXT("OFF"),
@@ -509,7 +539,7 @@ void UVMSplitBlueprintLibrary::FocusCameraOnActor(int32 LocalPlayerIndex, AActor
 	AVMCameraPawn* CameraPawn = GetVMCameraPawn(LocalPlayerIndex);
 	if (!CameraPawn)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("FocusCameraOnActor - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("FocusCameraOnActor - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 		return;
 	}
 
@@ -519,7 +549,7 @@ void UVMSplitBlueprintLibrary::FocusCameraOnActor(int32 LocalPlayerIndex, AActor
 
 	CameraPawn->FocusOnActor(TargetActor, Distance);
 
-	UE_LOG(LogViewportManager, Log, TEXT("FocusCameraOnActor - Player %d focusing on %s (tracking=%s)"),
+	UE_LOG(LogViewportManager, Verbose, TEXT("FocusCameraOnActor - Player %d focusing on %s (tracking=%s)"),
 		LocalPlayerIndex,
 		*TargetActor->GetName(),
 		bTrackActor ? TEXT("ON") : TEXT("OFF"));
@@ -572,7 +602,7 @@ void UVMSplitBlueprintLibrary::EnableAllCameraControls(int32 LocalPlayerIndex, b
 	AVMCameraPawn* CameraPawn = GetVMCameraPawn(LocalPlayerIndex);
 	if (!CameraPawn)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("EnableAllCameraControls - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("EnableAllCameraControls - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 		return;
 	}
 
@@ -580,7 +610,7 @@ void UVMSplitBlueprintLibrary::EnableAllCameraControls(int32 LocalPlayerIndex, b
 	CameraPawn->SetPanEnabled(bEnabled);
 	CameraPawn->SetZoomEnabled(bEnabled);
 
-	UE_LOG(LogViewportManager, Log, TEXT("EnableAllCameraControls - Player %d: All controls %s"),
+	UE_LOG(LogViewportManager, Verbose, TEXT("EnableAllCameraControls - Player %d: All controls %s"),
 		LocalPlayerIndex,
 		bEnabled ? TEXT("ENABLED") : TEXT("DISABLED"));
 }
@@ -590,13 +620,13 @@ void UVMSplitBlueprintLibrary::ResetCamera(int32 LocalPlayerIndex)
 	AVMCameraPawn* CameraPawn = GetVMCameraPawn(LocalPlayerIndex);
 	if (!CameraPawn)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("ResetCamera - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
+		VM_LOG_RATE_LIMITED(LogViewportManager, Warning, 1.0, TEXT("ResetCamera - Could not find VMCameraPawn for LocalPlayer %d"), LocalPlayerIndex);
 		return;
 	}
 
 	CameraPawn->ResetToStartingPosition();
 
-	UE_LOG(LogViewportManager, Log, TEXT("ResetCamera - Player %d camera reset to starting position"), LocalPlayerIndex);
+	UE_LOG(LogViewportManager, Verbose, TEXT("ResetCamera - Player %d camera reset to starting position"), LocalPlayerIndex);
 }
 
 int32 UVMSplitBlueprintLibrary::GetFocusedPlayer()
@@ -637,7 +667,7 @@ void UVMSplitBlueprintLibrary::SetClickToFocusEnabled(bool bEnabled)
 			if (UVMGameViewportClient* VMViewportClient = Cast<UVMGameViewportClient>(GameInstance->GetGameViewportClient()))
 			{
 				VMViewportClient->SetClickToFocusEnabled(bEnabled);
-				UE_LOG(LogViewportManager, Log, TEXT("SetClickToFocusEnabled - Click-to-focus %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+				UE_LOG(LogViewportManager, Verbose, TEXT("SetClickToFocusEnabled - Click-to-focus %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
 			}
 		}
 	}
@@ -667,7 +697,7 @@ void UVMSplitBlueprintLibrary::SetFocusHighlightingEnabled(bool bEnabled)
 			if (UVMGameViewportClient* VMViewportClient = Cast<UVMGameViewportClient>(GameInstance->GetGameViewportClient()))
 			{
 				VMViewportClient->SetFocusHighlightingEnabled(bEnabled);
-				UE_LOG(LogViewportManager, Log, TEXT("SetFocusHighlightingEnabled - Focus highlighting %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+				UE_LOG(LogViewportManager, Verbose, TEXT("SetFocusHighlightingEnabled - Focus highlighting %s"), bEnabled ? TEXT("enabled") : TEXT("disabled"));
 			}
 		}
 	}
@@ -16,14 +16,14 @@ AVMSplitGameMode::AVMSplitGameMode()
 
 	bAutoApplyDefaultLayout = true;
 
-	UE_LOG(LogViewportManager, Log, TEXT("AVMSplitGameMode::Constructor - ViewportManager GameMode initialized"));
+	UE_LOG(LogVMLayout, Log, TEXT("AVMSplitGameMode::Constructor - ViewportManager GameMode initialized"));
 }
 
 void AVMSplitGameMode::BeginPlay()
 {
 	Super::BeginPlay();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("AVMSplitGameMode::BeginPlay - Starting ViewportManager GameMode"));
+	UE_LOG(LogVMLayout, Log, TEXT("AVMSplitGameMode::BeginPlay - Starting ViewportManager GameMode"));
 
 	if (bAutoApplyDefaultLayout)
 	{
@@ -34,13 +34,13 @@ void AVMSplitGameMode::BeginPlay()
 
 APawn* AVMSplitGameMode::SpawnDefaultPawnFor_Implementation(AController* NewPlayer, AActor* StartSpot)
 {
-	UE_LOG(LogViewportManager, Log, TEXT("AVMSplitGameMode::SpawnDefaultPawnFor - Blocking default pawn spawn, ViewportManager will handle it"));
+	UE_LOG(LogVMLayout, Log, TEXT("AVMSplitGameMode::SpawnDefaultPawnFor - Blocking default pawn spawn, ViewportManager will handle it"));
 	return nullptr;
 }
 
 APawn* AVMSplitGameMode::SpawnDefaultPawnAtTransform_Implementation(AController* NewPlayer, const FTransform& SpawnTransform)
 {
-	UE_LOG(LogViewportManager, Log, TEXT("AVMSplitGameMode::SpawnDefaultPawnAtTransform - Blocking default pawn spawn, ViewportManager will handle it"));
+	UE_LOG(LogVMLayout, Log, TEXT("AVMSplitGameMode::SpawnDefaultPawnAtTransform - Blocking default pawn spawn, ViewportManager will handle it"));
 	return nullptr;
 }
 
@@ -48,21 +48,15 @@ void AVMSplitGameMode::ApplyDefaultLayoutIfSet()
 {
 	if (!DefaultLayout.IsNull())
 	{
-		UVMSplitLayoutAsset* LayoutAsset = DefaultLayout.LoadSynchronous();
-		if (LayoutAsset)
+		if (UVMSplitSubsystem* VMSubsystem = GetGameInstance()->GetSubsystem<UVMSplitSubsystem>())
 		{
-			if (UVMSplitSubsystem* VMSubsystem = GetGameInstance()->GetSubsystem<UVMSplitSubsystem>())
-			{
-				VMSubsystem->ApplyLayout(LayoutAsset);
-				UE_LOG(LogViewportManager, Log, TEXT("AVMSplitGameMode::ApplyDefaultLayoutIfSet - Applied default layout"));
-			}
+			// Streams the layout and its pane classes without blocking the game thread
+			VMSubsystem->ApplyLayoutAsync(DefaultLayout);
+			UE_LOG(LogVMLayout, Log, TEXT("AVMSplitGameMode::ApplyDefaultLayoutIfSet - Requested default layout"));
 		}
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Log, TEXT("AVMSplitGameMode::ApplyDefaultLayoutIfSet - No default layout set"));
+		UE_LOG(LogVMLayout, Log, TEXT("AVMSplitGameMode::ApplyDefaultLayoutIfSet - No default layout set"));
 	}
 }
-
-
-
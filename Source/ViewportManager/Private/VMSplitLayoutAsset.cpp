@@ -3,11 +3,14 @@
 #include "VMSplitLayoutAsset.h"
 #include "Engine/Engine.h"
 #include "GameFramework/Pawn.h"
+#include "VMMirrorPanes.h"
 #include "VMLog.h"
 
 void UVMSplitLayoutAsset::ValidateLayout()
 {
 	TSet<int32> UsedIndices;
+	TSet<int32> UsedGamepads;
+	bool bHasFixedKeyboardMouseTarget = false;
 	TArray<FString> Warnings;
 
 	for (int32 i = 0; i < Panes.Num(); ++i)
@@ -27,11 +30,36 @@ void UVMSplitLayoutAsset::ValidateLayout()
 			UsedIndices.Add(Pane.LocalPlayerIndex);
 		}
 
-		if (Pane.CameraMode == EVMViewportCameraMode::Custom && !Pane.CustomPawnClass)
+		if (Pane.CameraMode == EVMViewportCameraMode::Custom && Pane.GetCustomPawnClassRef().IsNull())
 		{
 			Warnings.Add(FString::Printf(TEXT("Pane %d is set to Custom camera mode but has no CustomPawnClass assigned."), i));
 		}
 
+		if (Pane.HasLegacyClassReferences())
+		{
+			Warnings.Add(FString::Printf(TEXT("Pane %d uses legacy hard class references that load with the layout. Run MigrateToSoftClassReferences."), i));
+		}
+
+		if (Pane.bMirror && FVMMirrorPaneSet::FindSourcePane(*this, Pane) == INDEX_NONE)
+		{
+			Warnings.Add(FString::Printf(TEXT("Mirror pane %d has no player or view-only pane with LocalPlayerIndex %d to mirror."), i, Pane.MirrorSourcePlayerIndex));
+		}
+
+		if (Pane.GamepadIndex >= 0)
+		{
+			if (!Pane.NeedsLocalPlayer())
+			{
+				Warnings.Add(FString::Printf(TEXT("Pane %d routes gamepad %d but has no local player to receive it."), i, Pane.GamepadIndex));
+			}
+			else if (UsedGamepads.Contains(Pane.GamepadIndex))
+			{
+				Warnings.Add(FString::Printf(TEXT("Gamepad %d is routed to multiple panes; the top-most one receives it."), Pane.GamepadIndex));
+			}
+			UsedGamepads.Add(Pane.GamepadIndex);
+		}
+
+		bHasFixedKeyboardMouseTarget |= Pane.bFixedKeyboardMouseTarget && Pane.NeedsLocalPlayer();
+
 		if (Pane.Rect.Origin01.X < 0.f || Pane.Rect.Origin01.X > 1.f ||
 			Pane.Rect.Origin01.Y < 0.f || Pane.Rect.Origin01.Y > 1.f)
 		{
@@ -53,17 +81,67 @@ void UVMSplitLayoutAsset::ValidateLayout()
 		}
 	}
 
+	if ((KeyboardRouting == EVMInputRoutingPolicy::Fixed || MouseRouting == EVMInputRoutingPolicy::Fixed) && !bHasFixedKeyboardMouseTarget)
+	{
+		Warnings.Add(TEXT("Keyboard or mouse routing is Fixed but no player pane is marked bFixedKeyboardMouseTarget; input falls back to hover routing."));
+	}
+
 	for (const FString& Warning : Warnings)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("VMSplitLayoutAsset: %s"), *Warning);
+		UE_LOG(LogVMLayout, Warning, TEXT("VMSplitLayoutAsset: %s"), *Warning);
 	}
 
 	if (Warnings.Num() == 0)
 	{
-		UE_LOG(LogViewportManager, Log, TEXT("VMSplitLayoutAsset: Layout validation passed."));
+		UE_LOG(LogVMLayout, Log, TEXT("VMSplitLayoutAsset: Layout validation passed."));
 	}
 }
 
+void UVMSplitLayoutAsset::MigrateToSoftClassReferences()
+{
+	int32 MigratedReferences = 0;
+
+	for (FVMSplitPane& Pane : Panes)
+	{
+		if (Pane.PawnClass)
+		{
+			if (Pane.SoftPawnClass.IsNull())
+			{
+				Pane.SoftPawnClass = Pane.PawnClass.Get();
+			}
+			Pane.PawnClass = nullptr;
+			++MigratedReferences;
+		}
+
+		if (Pane.CustomPawnClass)
+		{
+			if (Pane.SoftCustomPawnClass.IsNull())
+			{
+				Pane.SoftCustomPawnClass = Pane.CustomPawnClass.Get();
+			}
+			Pane.CustomPawnClass = nullptr;
+			++MigratedReferences;
+		}
+
+		if (Pane.ViewportHUDClass)
+		{
+			if (Pane.SoftViewportHUDClass.IsNull())
+			{
+				Pane.SoftViewportHUDClass = Pane.ViewportHUDClass.Get();
+			}
+			Pane.ViewportHUDClass = nullptr;
+			++MigratedReferences;
+		}
+	}
+
+	if (MigratedReferences > 0)
+	{
+		MarkPackageDirty();
+	}
+
+	UE_LOG(LogVMLayout, Log, TEXT("VMSplitLayoutAsset: Migrated %d hard class references to soft references in '%s'."), MigratedReferences, *GetName());
+}
+
 #if WITH_EDITOR
 void UVMSplitLayoutAsset::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
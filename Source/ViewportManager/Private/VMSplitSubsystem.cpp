@@ -8,43 +8,82 @@
 #include "Engine/LocalPlayer.h"
 #include "GameFramework/PlayerController.h"
 #include "VMViewportManagerSettings.h"
+#include "HAL/PlatformTime.h"
 #include "VMLog.h"
+#include "VMStats.h"
+
 void UVMSplitSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
 
 	FWorldDelegates::OnPostWorldInitialization.AddUObject(this, &UVMSplitSubsystem::OnWorldInitialized);
 
-	UE_LOG(LogViewportManager, Log, TEXT("UVMSplitSubsystem::Initialize - Subsystem initialized"));
+	UE_LOG(LogVMLayout, Log, TEXT("UVMSplitSubsystem::Initialize - Subsystem initialized"));
 }
 
 void UVMSplitSubsystem::Deinitialize()
 {
 	FWorldDelegates::OnPostWorldInitialization.RemoveAll(this);
+	CancelAsyncLayoutLoad();
+	ReleaseLoadHandles(AppliedLayoutHandles);
 
 	Super::Deinitialize();
 
-	UE_LOG(LogViewportManager, Log, TEXT("UVMSplitSubsystem::Deinitialize - Subsystem deinitialized"));
+	UE_LOG(LogVMLayout, Log, TEXT("UVMSplitSubsystem::Deinitialize - Subsystem deinitialized"));
 }
 
 void UVMSplitSubsystem::ApplyLayout(UVMSplitLayoutAsset* Layout)
 {
 	if (!Layout)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::ApplyLayout - Layout is null"));
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::ApplyLayout - Layout is null"));
 		return;
 	}
 
+	// Classes streamed for the previous layout may be unloaded once a different layout replaces it
+	if (Layout != CurrentLayout)
+	{
+		ReleaseLoadHandles(AppliedLayoutHandles);
+	}
+
 	CurrentLayout = Layout;
+	CancelAsyncLayoutLoad();
 
 	if (UVMGameViewportClient* ViewportClient = GetViewportClient())
 	{
 		ViewportClient->ApplyLayout(Layout);
-		UE_LOG(LogViewportManager, Log, TEXT("UVMSplitSubsystem::ApplyLayout - Applied layout to viewport client"));
+		UE_LOG(LogVMLayout, Verbose, TEXT("UVMSplitSubsystem::ApplyLayout - Applied layout to viewport client"));
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::ApplyLayout - Could not get viewport client"));
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::ApplyLayout - Could not get viewport client"));
+	}
+}
+
+void UVMSplitSubsystem::TransitionToLayout(UVMSplitLayoutAsset* Layout, float Duration, UCurveFloat* Curve)
+{
+	if (!Layout)
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::TransitionToLayout - Layout is null"));
+		return;
+	}
+
+	// Classes streamed for the previous layout may be unloaded once a different layout replaces it
+	if (Layout != CurrentLayout)
+	{
+		ReleaseLoadHandles(AppliedLayoutHandles);
+	}
+
+	CurrentLayout = Layout;
+	CancelAsyncLayoutLoad();
+
+	if (UVMGameViewportClient* ViewportClient = GetViewportClient())
+	{
+		ViewportClient->TransitionToLayout(Layout, Duration, Curve);
+	}
+	else
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::TransitionToLayout - Could not get viewport client"));
 	}
 }
 
@@ -52,7 +91,7 @@ void UVMSplitSubsystem::SetPaneRect(int32 LocalPlayerIndex, float OriginX, float
 {
 	if (!CurrentLayout)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::SetPaneRect - No current layout"));
+		VM_LOG_RATE_LIMITED(LogVMLayout, Warning, 1.0, TEXT("UVMSplitSubsystem::SetPaneRect - No current layout"));
 		return;
 	}
 
@@ -63,18 +102,196 @@ void UVMSplitSubsystem::SetPaneRect(int32 LocalPlayerIndex, float OriginX, float
 			Pane.Rect.Origin01 = FVector2f(OriginX, OriginY);
 			Pane.Rect.Size01 = FVector2f(SizeX, SizeY);
 
-			if (UVMGameViewportClient* ViewportClient = GetViewportClient())
-			{
-				ViewportClient->ApplyLayout(CurrentLayout);
-			}
+			ApplyCurrentLayoutOrDefer();
 
-			UE_LOG(LogViewportManager, Log, TEXT("UVMSplitSubsystem::SetPaneRect - Updated pane %d rect to (%.2f, %.2f, %.2f, %.2f)"), 
+			UE_LOG(LogVMLayout, Verbose, TEXT("UVMSplitSubsystem::SetPaneRect - Updated pane %d rect to (%.2f, %.2f, %.2f, %.2f)"), 
 				LocalPlayerIndex, OriginX, OriginY, SizeX, SizeY);
 			return;
 		}
 	}
 
-	UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::SetPaneRect - Could not find pane with LocalPlayerIndex %d"), LocalPlayerIndex);
+	VM_LOG_RATE_LIMITED(LogVMLayout, Warning, 1.0, TEXT("UVMSplitSubsystem::SetPaneRect - Could not find pane with LocalPlayerIndex %d"), LocalPlayerIndex);
+}
+
+bool UVMSplitSubsystem::SetPaneRects(const TArray<FVMPaneRectEdit>& Edits, FString& OutError)
+{
+	if (!CurrentLayout)
+	{
+		OutError = TEXT("No current layout");
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::SetPaneRects - %s"), *OutError);
+		return false;
+	}
+
+	// Validate the whole batch before touching the layout so a bad entry cannot leave it half-edited
+	OutError.Reset();
+	TArray<FVMSplitPane*, TInlineAllocator<8>> TargetPanes;
+	TSet<int32> EditedIndices;
+	for (const FVMPaneRectEdit& Edit : Edits)
+	{
+		FVMSplitPane* TargetPane = CurrentLayout->Panes.FindByPredicate([&Edit](const FVMSplitPane& Pane)
+		{
+			return Pane.LocalPlayerIndex == Edit.LocalPlayerIndex;
+		});
+
+		FString RectError;
+		if (!TargetPane)
+		{
+			OutError = FString::Printf(TEXT("Could not find pane with LocalPlayerIndex %d"), Edit.LocalPlayerIndex);
+		}
+		else if (EditedIndices.Contains(Edit.LocalPlayerIndex))
+		{
+			OutError = FString::Printf(TEXT("Pane %d is edited more than once"), Edit.LocalPlayerIndex);
+		}
+		else if (!ValidatePaneRect(Edit.Rect, RectError))
+		{
+			OutError = FString::Printf(TEXT("Pane %d: %s"), Edit.LocalPlayerIndex, *RectError);
+		}
+
+		if (!OutError.IsEmpty())
+		{
+			UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::SetPaneRects - Rejected batch: %s"), *OutError);
+			return false;
+		}
+
+		EditedIndices.Add(Edit.LocalPlayerIndex);
+		TargetPanes.Add(TargetPane);
+	}
+
+	for (int32 i = 0; i < Edits.Num(); ++i)
+	{
+		TargetPanes[i]->Rect = Edits[i].Rect;
+	}
+
+	ApplyCurrentLayoutOrDefer();
+
+	UE_LOG(LogVMLayout, Verbose, TEXT("UVMSplitSubsystem::SetPaneRects - Updated %d pane rects"), Edits.Num());
+	return true;
+}
+
+void UVMSplitSubsystem::BeginLayoutEdit()
+{
+	LLM_SCOPE_BYTAG(ViewportManager_Layout);
+
+	if (LayoutEditDepth++ > 0)
+	{
+		return;
+	}
+
+	LayoutEditTarget = CurrentLayout;
+	LayoutEditSnapshot = CurrentLayout ? CurrentLayout->Panes : TArray<FVMSplitPane>();
+	bLayoutEditDirty = false;
+}
+
+bool UVMSplitSubsystem::CommitLayoutEdit(FString& OutError)
+{
+	if (LayoutEditDepth == 0)
+	{
+		OutError = TEXT("No layout edit is open");
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::CommitLayoutEdit - %s"), *OutError);
+		return false;
+	}
+
+	if (--LayoutEditDepth > 0)
+	{
+		return true;
+	}
+
+	if (CurrentLayout != LayoutEditTarget)
+	{
+		OutError = TEXT("A different layout was applied while the edit was open");
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::CommitLayoutEdit - Rolled back: %s"), *OutError);
+		if (LayoutEditTarget)
+		{
+			LayoutEditTarget->Panes = LayoutEditSnapshot;
+		}
+		EndLayoutEdit();
+		return false;
+	}
+
+	if (CurrentLayout && bLayoutEditDirty)
+	{
+		for (const FVMSplitPane& Pane : CurrentLayout->Panes)
+		{
+			FString RectError;
+			if (!ValidatePaneRect(Pane.Rect, RectError))
+			{
+				OutError = FString::Printf(TEXT("Pane %d: %s"), Pane.LocalPlayerIndex, *RectError);
+				UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::CommitLayoutEdit - Rolled back: %s"), *OutError);
+				CurrentLayout->Panes = LayoutEditSnapshot;
+				EndLayoutEdit();
+				return false;
+			}
+		}
+
+		if (UVMGameViewportClient* ViewportClient = GetViewportClient())
+		{
+			ViewportClient->ApplyLayout(CurrentLayout);
+		}
+	}
+
+	EndLayoutEdit();
+	return true;
+}
+
+void UVMSplitSubsystem::CancelLayoutEdit()
+{
+	if (LayoutEditDepth == 0)
+	{
+		return;
+	}
+
+	// Restore even if another layout was applied meanwhile, so the asset never keeps uncommitted edits
+	if (LayoutEditTarget)
+	{
+		LayoutEditTarget->Panes = LayoutEditSnapshot;
+	}
+
+	LayoutEditDepth = 0;
+	EndLayoutEdit();
+}
+
+void UVMSplitSubsystem::EndLayoutEdit()
+{
+	LayoutEditSnapshot.Reset();
+	LayoutEditTarget = nullptr;
+	bLayoutEditDirty = false;
+}
+
+void UVMSplitSubsystem::ApplyCurrentLayoutOrDefer()
+{
+	if (LayoutEditDepth > 0)
+	{
+		bLayoutEditDirty = true;
+		return;
+	}
+
+	if (UVMGameViewportClient* ViewportClient = GetViewportClient())
+	{
+		ViewportClient->ApplyLayout(CurrentLayout);
+	}
+}
+
+bool UVMSplitSubsystem::ValidatePaneRect(const FVMSplitRect& Rect, FString& OutError)
+{
+	if (Rect.Origin01.X < 0.0f || Rect.Origin01.Y < 0.0f || Rect.Origin01.X > 1.0f || Rect.Origin01.Y > 1.0f)
+	{
+		OutError = FString::Printf(TEXT("origin (%.3f, %.3f) is outside the screen"), Rect.Origin01.X, Rect.Origin01.Y);
+		return false;
+	}
+
+	if (Rect.Size01.X <= 0.0f || Rect.Size01.Y <= 0.0f)
+	{
+		OutError = FString::Printf(TEXT("size (%.3f, %.3f) must be positive"), Rect.Size01.X, Rect.Size01.Y);
+		return false;
+	}
+
+	if (Rect.Origin01.X + Rect.Size01.X > 1.0f + KINDA_SMALL_NUMBER || Rect.Origin01.Y + Rect.Size01.Y > 1.0f + KINDA_SMALL_NUMBER)
+	{
+		OutError = TEXT("rect extends past the screen edge");
+		return false;
+	}
+
+	return true;
 }
 
 bool UVMSplitSubsystem::GetPaneRect(int32 LocalPlayerIndex, FVector2f& OutOrigin01, FVector2f& OutSize01)
@@ -101,7 +318,7 @@ void UVMSplitSubsystem::SetPanePawnClass(int32 LocalPlayerIndex, TSubclassOf<APa
 {
 	if (!CurrentLayout)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::SetPanePawnClass - No current layout"));
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::SetPanePawnClass - No current layout"));
 		return;
 	}
 
@@ -109,19 +326,18 @@ void UVMSplitSubsystem::SetPanePawnClass(int32 LocalPlayerIndex, TSubclassOf<APa
 	{
 		if (Pane.LocalPlayerIndex == LocalPlayerIndex)
 		{
-			Pane.PawnClass = PawnClass;
+			// Clear the legacy hard reference so it can neither pin the old class nor shadow a null soft class
+			Pane.SoftPawnClass = PawnClass.Get();
+			Pane.PawnClass = nullptr;
 
-			if (UVMGameViewportClient* ViewportClient = GetViewportClient())
-			{
-				ViewportClient->ApplyLayout(CurrentLayout);
-			}
+			ApplyCurrentLayoutOrDefer();
 
-			UE_LOG(LogViewportManager, Log, TEXT("UVMSplitSubsystem::SetPanePawnClass - Updated pane %d pawn class"), LocalPlayerIndex);
+			UE_LOG(LogVMLayout, Verbose, TEXT("UVMSplitSubsystem::SetPanePawnClass - Updated pane %d pawn class"), LocalPlayerIndex);
 			return;
 		}
 	}
 
-	UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::SetPanePawnClass - Could not find pane with LocalPlayerIndex %d"), LocalPlayerIndex);
+	VM_LOG_RATE_LIMITED(LogVMLayout, Warning, 1.0, TEXT("UVMSplitSubsystem::SetPanePawnClass - Could not find pane with LocalPlayerIndex %d"), LocalPlayerIndex);
 }
 
 void UVMSplitSubsystem::SetActiveKeyboardMousePlayer(int32 LocalPlayerIndex)
@@ -132,7 +348,7 @@ void UVMSplitSubsystem::SetActiveKeyboardMousePlayer(int32 LocalPlayerIndex)
 	}
 	else
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("UVMSplitSubsystem::SetActiveKeyboardMousePlayer - Could not get viewport client"));
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::SetActiveKeyboardMousePlayer - Could not get viewport client"));
 	}
 }
 
@@ -199,37 +415,176 @@ void UVMSplitSubsystem::LoadDefaultLayout()
 	const UVMViewportManagerSettings* Settings = GetDefault<UVMViewportManagerSettings>();
 	if (!Settings)
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("Viewport Manager settings class is unavailable; skipping default layout load."));
+		UE_LOG(LogVMLayout, Warning, TEXT("Viewport Manager settings class is unavailable; skipping default layout load."));
 		return;
 	}
 
 	if (!Settings->bApplyDefaultLayoutOnWorldInit)
 	{
-		UE_LOG(LogViewportManager, Verbose, TEXT("Default layout application disabled in settings."));
+		UE_LOG(LogVMLayout, Verbose, TEXT("Default layout application disabled in settings."));
 		return;
 	}
 
 	if (!Settings->DefaultLayout.IsValid() && !Settings->DefaultLayout.ToSoftObjectPath().IsValid())
 	{
-		UE_LOG(LogViewportManager, Verbose, TEXT("No default layout configured."));
+		UE_LOG(LogVMLayout, Verbose, TEXT("No default layout configured."));
 		return;
 	}
 
-	UVMSplitLayoutAsset* Layout = Settings->DefaultLayout.IsValid()
-		? Settings->DefaultLayout.Get()
-		: Settings->DefaultLayout.LoadSynchronous();
+	// Even a resident layout goes through the async path so its Eager pane classes stream instead of loading synchronously
+	UE_LOG(LogVMLayout, Log, TEXT("Streaming default layout '%s' from settings."), *Settings->DefaultLayout.ToString());
+	ApplyLayoutAsync(Settings->DefaultLayout);
+}
 
-	if (!Layout)
+void UVMSplitSubsystem::ApplyLayoutAsync(TSoftObjectPtr<UVMSplitLayoutAsset> Layout)
+{
+	if (Layout.IsNull())
 	{
-		UE_LOG(LogViewportManager, Warning, TEXT("Failed to load default layout asset '%s'."), *Settings->DefaultLayout.ToString());
+		UE_LOG(LogVMLayout, Warning, TEXT("UVMSplitSubsystem::ApplyLayoutAsync - Layout is null"));
 		return;
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("Applying default layout '%s' from settings."), *Layout->GetName());
-	ApplyLayout(Layout);
+	CancelAsyncLayoutLoad();
+	LastLayoutLoadTimings.Reset();
+
+	const int32 RequestId = ++AsyncLayoutRequestId;
+	const FSoftObjectPath LayoutPath = Layout.ToSoftObjectPath();
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(LayoutPath,
+		FStreamableDelegate::CreateUObject(this, &UVMSplitSubsystem::OnAsyncLayoutLoaded, RequestId, LayoutPath, FPlatformTime::Seconds()));
+
+	// If the layout was already resident the callback may have run and applied it before we get here
+	if (Handle.IsValid() && RequestId == AsyncLayoutRequestId)
+	{
+		PendingLayoutLoadHandles.Add(Handle);
+	}
+}
+
+void UVMSplitSubsystem::OnAsyncLayoutLoaded(int32 RequestId, FSoftObjectPath LayoutPath, double RequestTime)
+{
+	if (RequestId != AsyncLayoutRequestId)
+	{
+		return;
+	}
+
+	FVMDependencyLoadTiming& LayoutTiming = LastLayoutLoadTimings.AddDefaulted_GetRef();
+	LayoutTiming.AssetPath = LayoutPath;
+	LayoutTiming.LoadSeconds = static_cast<float>(FPlatformTime::Seconds() - RequestTime);
+
+	PendingAsyncLayout = Cast<UVMSplitLayoutAsset>(LayoutPath.ResolveObject());
+	if (!PendingAsyncLayout)
+	{
+		UE_LOG(LogVMLayout, Warning, TEXT("Failed to load layout asset '%s'."), *LayoutPath.ToString());
+		CancelAsyncLayoutLoad();
+		return;
+	}
+
+	UE_LOG(LogVMLayout, Log, TEXT("Layout '%s' resident after %.2fms; streaming pane dependencies."),
+		*LayoutPath.ToString(), LayoutTiming.LoadSeconds * 1000.0f);
+
+	TSet<FSoftObjectPath> Dependencies;
+	for (const FVMSplitPane& Pane : PendingAsyncLayout->Panes)
+	{
+		// OnApply and OnFirstVisibility panes load their classes later, on the viewport client
+		if (Pane.ClassLoadPolicy != EVMPaneClassLoadPolicy::Eager)
+		{
+			continue;
+		}
+
+		for (const FSoftObjectPath& ClassPath : { Pane.GetPawnClassRef().ToSoftObjectPath(), Pane.GetCustomPawnClassRef().ToSoftObjectPath(), Pane.GetViewportHUDClassRef().ToSoftObjectPath() })
+		{
+			if (!ClassPath.IsNull())
+			{
+				Dependencies.Add(ClassPath);
+			}
+		}
+	}
+
+	// Count everything up front so callbacks that fire synchronously cannot finish the load early
+	OutstandingDependencyLoads = Dependencies.Num() + 1;
+	for (const FSoftObjectPath& Dependency : Dependencies)
+	{
+		TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(Dependency,
+			FStreamableDelegate::CreateUObject(this, &UVMSplitSubsystem::OnAsyncDependencyLoaded, RequestId, Dependency, FPlatformTime::Seconds()));
+
+		if (Handle.IsValid() && RequestId == AsyncLayoutRequestId)
+		{
+			PendingLayoutLoadHandles.Add(Handle);
+		}
+	}
+
+	FinishAsyncLayoutLoad(RequestId);
 }
 
+void UVMSplitSubsystem::OnAsyncDependencyLoaded(int32 RequestId, FSoftObjectPath DependencyPath, double RequestTime)
+{
+	if (RequestId != AsyncLayoutRequestId)
+	{
+		return;
+	}
 
+	FVMDependencyLoadTiming& Timing = LastLayoutLoadTimings.AddDefaulted_GetRef();
+	Timing.AssetPath = DependencyPath;
+	Timing.LoadSeconds = static_cast<float>(FPlatformTime::Seconds() - RequestTime);
 
+	UE_LOG(LogVMLayout, Log, TEXT("Layout dependency '%s' resident after %.2fms."),
+		*DependencyPath.ToString(), Timing.LoadSeconds * 1000.0f);
 
+	FinishAsyncLayoutLoad(RequestId);
+}
 
+void UVMSplitSubsystem::FinishAsyncLayoutLoad(int32 RequestId)
+{
+	if (RequestId != AsyncLayoutRequestId || --OutstandingDependencyLoads > 0)
+	{
+		return;
+	}
+
+	UVMSplitLayoutAsset* Layout = PendingAsyncLayout;
+	double TotalSeconds = 0.0;
+	for (const FVMDependencyLoadTiming& Timing : LastLayoutLoadTimings)
+	{
+		TotalSeconds += Timing.LoadSeconds;
+	}
+
+	UE_LOG(LogVMLayout, Log, TEXT("Layout '%s' and %d dependencies streamed (%.2fms cumulative); applying."),
+		*Layout->GetName(), LastLayoutLoadTimings.Num() - 1, TotalSeconds * 1000.0);
+
+	// The layout only holds soft references, and staged or deferred applies resolve its classes frames later,
+	// so the handles stay with the applied layout instead of being released by ApplyLayout
+	TArray<TSharedPtr<FStreamableHandle>> LayoutHandles = MoveTemp(PendingLayoutLoadHandles);
+	PendingLayoutLoadHandles.Reset();
+
+	ApplyLayout(Layout);
+	AppliedLayoutHandles = MoveTemp(LayoutHandles);
+}
+
+void UVMSplitSubsystem::ReleaseLoadHandles(TArray<TSharedPtr<FStreamableHandle>>& Handles)
+{
+	for (const TSharedPtr<FStreamableHandle>& Handle : Handles)
+	{
+		if (!Handle.IsValid())
+		{
+			continue;
+		}
+
+		if (Handle->HasLoadCompleted())
+		{
+			Handle->ReleaseHandle();
+		}
+		else
+		{
+			Handle->CancelHandle();
+		}
+	}
+
+	Handles.Reset();
+}
+
+void UVMSplitSubsystem::CancelAsyncLayoutLoad()
+{
+	ReleaseLoadHandles(PendingLayoutLoadHandles);
+	PendingAsyncLayout = nullptr;
+	OutstandingDependencyLoads = 0;
+	++AsyncLayoutRequestId;
+}
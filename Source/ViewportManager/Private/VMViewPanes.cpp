@@ -0,0 +1,236 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "VMViewPanes.h"
+#include "VMSplitLayoutAsset.h"
+#include "VMPaneRenderProfile.h"
+#include "CanvasItem.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/Canvas.h"
+#include "Engine/SceneCapture2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/World.h"
+#include "VMLog.h"
+
+void FVMViewPaneSet::Rebuild(const UVMSplitLayoutAsset& Layout, UWorld* World, const FIntPoint& ViewportSize, TConstArrayView<float> ResolutionScales)
+{
+	TArray<FVMViewPaneInstance> Previous = MoveTemp(Instances);
+	Instances.Reset();
+
+	if (World)
+	{
+		for (int32 PaneIndex = 0; PaneIndex < Layout.Panes.Num(); ++PaneIndex)
+		{
+			const FVMSplitPane& Pane = Layout.Panes[PaneIndex];
+			if (!Pane.bViewOnly)
+			{
+				continue;
+			}
+
+			FVMViewPaneInstance Instance;
+			while (Previous.Num() > 0)
+			{
+				Instance = Previous.Pop(EAllowShrinking::No);
+				if (Instance.Capture.IsValid() && Instance.Capture->GetWorld() == World)
+				{
+					break;
+				}
+				Instance = FVMViewPaneInstance();
+			}
+
+			Instance.PaneIndex = PaneIndex;
+			Instance.Target = Pane.ViewTarget.Get();
+			Instance.ResolutionScale = ResolutionScales.IsValidIndex(PaneIndex) ? ResolutionScales[PaneIndex] : 1.0f;
+
+			const FIntPoint TargetSize = GetRenderTargetSize(Pane, ViewportSize, Instance.ResolutionScale);
+			if (!Instance.RenderTarget)
+			{
+				Instance.RenderTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+				Instance.RenderTarget->ClearColor = FLinearColor::Black;
+				Instance.RenderTarget->InitAutoFormat(TargetSize.X, TargetSize.Y);
+			}
+			else if (Instance.RenderTarget->SizeX != TargetSize.X || Instance.RenderTarget->SizeY != TargetSize.Y)
+			{
+				Instance.RenderTarget->ResizeTarget(TargetSize.X, TargetSize.Y);
+			}
+
+			if (!Instance.Capture.IsValid())
+			{
+				FActorSpawnParameters SpawnParams;
+				SpawnParams.ObjectFlags |= RF_Transient;
+				SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+				ASceneCapture2D* Capture = World->SpawnActor<ASceneCapture2D>(ComputeViewTransform(Pane, Instance.Target.Get()), SpawnParams);
+				if (!Capture)
+				{
+					UE_LOG(LogVMLayout, Warning, TEXT("Failed to spawn scene capture for view pane %d"), Pane.LocalPlayerIndex);
+					continue;
+				}
+
+				Capture->SetActorTickEnabled(false);
+				Instance.Capture = Capture;
+			}
+			else
+			{
+				Instance.Capture->SetActorTransform(ComputeViewTransform(Pane, Instance.Target.Get()));
+			}
+
+			USceneCaptureComponent2D* CaptureComponent = Instance.Capture->GetCaptureComponent2D();
+			CaptureComponent->TextureTarget = Instance.RenderTarget;
+			CaptureComponent->CaptureSource = ESceneCaptureSource::SCS_FinalColorLDR;
+			CaptureComponent->FOVAngle = Pane.ViewFieldOfView;
+			CaptureComponent->bCaptureEveryFrame = false;
+			CaptureComponent->bCaptureOnMovement = false;
+
+			// Captures own their show flags, so view panes get the whole profile rather than the shared subset
+			const UVMPaneRenderProfile* Profile = Pane.RenderProfile;
+			CaptureComponent->ShowFlagSettings = Profile ? Profile->ShowFlagOverrides : TArray<FEngineShowFlagsSetting>();
+			CaptureComponent->UpdateShowFlags();
+			CaptureComponent->LODDistanceFactor = Profile ? Profile->LODDistanceFactor : 1.0f;
+			CaptureComponent->MaxViewDistanceOverride = Profile && Profile->MaxViewDistance > 0.0f ? Profile->MaxViewDistance : -1.0f;
+			CaptureComponent->PostProcessBlendWeight = Profile ? Profile->PostProcessBlendWeight : 0.0f;
+			if (Profile)
+			{
+				CaptureComponent->PostProcessSettings = Profile->PostProcessSettings;
+			}
+
+			Instances.Add(Instance);
+		}
+	}
+
+	for (const FVMViewPaneInstance& Unused : Previous)
+	{
+		if (ASceneCapture2D* Capture = Unused.Capture.Get())
+		{
+			Capture->Destroy();
+		}
+	}
+
+	UE_LOG(LogVMLayout, Verbose, TEXT("View panes rebuilt: %d active"), Instances.Num());
+}
+
+void FVMViewPaneSet::UpdateResolution(const UVMSplitLayoutAsset& Layout, const FIntPoint& ViewportSize, TConstArrayView<float> ResolutionScales)
+{
+	for (FVMViewPaneInstance& Instance : Instances)
+	{
+		if (!Layout.Panes.IsValidIndex(Instance.PaneIndex) || !Instance.RenderTarget)
+		{
+			continue;
+		}
+
+		Instance.ResolutionScale = ResolutionScales.IsValidIndex(Instance.PaneIndex) ? ResolutionScales[Instance.PaneIndex] : 1.0f;
+		ResizeRenderTarget(Instance, Layout.Panes[Instance.PaneIndex], ViewportSize);
+	}
+}
+
+void FVMViewPaneSet::Reset()
+{
+	for (const FVMViewPaneInstance& Instance : Instances)
+	{
+		if (ASceneCapture2D* Capture = Instance.Capture.Get())
+		{
+			Capture->Destroy();
+		}
+	}
+	Instances.Reset();
+}
+
+void FVMViewPaneSet::UpdateCameras(const UVMSplitLayoutAsset& Layout, const TBitArray<>& PanesDue)
+{
+	for (FVMViewPaneInstance& Instance : Instances)
+	{
+		if (!Layout.Panes.IsValidIndex(Instance.PaneIndex) || !Instance.Capture.IsValid())
+		{
+			continue;
+		}
+
+		if (PanesDue.IsValidIndex(Instance.PaneIndex) && !PanesDue[Instance.PaneIndex])
+		{
+			continue;
+		}
+
+		const FVMSplitPane& Pane = Layout.Panes[Instance.PaneIndex];
+		if (!Pane.ViewTarget.IsNull())
+		{
+			// The target may stream in after the layout was applied
+			if (!Instance.Target.IsValid())
+			{
+				Instance.Target = Pane.ViewTarget.Get();
+			}
+
+			if (const AActor* Target = Instance.Target.Get())
+			{
+				const FTransform ViewTransform = ComputeViewTransform(Pane, Target);
+				Instance.Capture->SetActorLocationAndRotation(ViewTransform.GetLocation(), ViewTransform.GetRotation());
+			}
+		}
+
+		Instance.Capture->GetCaptureComponent2D()->CaptureSceneDeferred();
+	}
+}
+
+void FVMViewPaneSet::Draw(UCanvas* Canvas, const UVMSplitLayoutAsset& Layout)
+{
+	const FIntPoint CanvasSize(FMath::RoundToInt(Canvas->ClipX), FMath::RoundToInt(Canvas->ClipY));
+
+	for (FVMViewPaneInstance& Instance : Instances)
+	{
+		if (!Layout.Panes.IsValidIndex(Instance.PaneIndex) || !Instance.RenderTarget)
+		{
+			continue;
+		}
+
+		const FVMSplitPane& Pane = Layout.Panes[Instance.PaneIndex];
+		ResizeRenderTarget(Instance, Pane, CanvasSize);
+
+		const FTextureResource* Resource = Instance.RenderTarget->GetResource();
+		if (!Resource)
+		{
+			continue;
+		}
+
+		const FVector2D Position(Pane.Rect.Origin01.X * CanvasSize.X, Pane.Rect.Origin01.Y * CanvasSize.Y);
+		const FVector2D Size(Pane.Rect.Size01.X * CanvasSize.X, Pane.Rect.Size01.Y * CanvasSize.Y);
+
+		FCanvasTileItem Tile(Position, Resource, Size, FLinearColor::White);
+		Tile.BlendMode = SE_BLEND_Opaque;
+		Canvas->DrawItem(Tile);
+	}
+}
+
+UTextureRenderTarget2D* FVMViewPaneSet::FindRenderTarget(int32 PaneIndex) const
+{
+	const FVMViewPaneInstance* Instance = Instances.FindByPredicate([PaneIndex](const FVMViewPaneInstance& Candidate)
+	{
+		return Candidate.PaneIndex == PaneIndex;
+	});
+	return Instance ? Instance->RenderTarget.Get() : nullptr;
+}
+
+FTransform FVMViewPaneSet::ComputeViewTransform(const FVMSplitPane& Pane, const AActor* Target)
+{
+	if (!Target && !Pane.bUseCustomFocusPoint)
+	{
+		return Pane.CameraTransform;
+	}
+
+	const FVector FocusPoint = Target ? Target->GetActorLocation() : Pane.FocusPoint;
+	const FVector CameraLocation = FocusPoint + FVector(-Pane.OrbitDistance, 0.0f, Pane.OrbitDistance * 0.5f);
+	return FTransform((FocusPoint - CameraLocation).Rotation(), CameraLocation, FVector::OneVector);
+}
+
+FIntPoint FVMViewPaneSet::GetRenderTargetSize(const FVMSplitPane& Pane, const FIntPoint& ViewportSize, float ResolutionScale)
+{
+	// The tile is stretched over the full pane rect, so a smaller target is a lower screen percentage
+	return FIntPoint(
+		FMath::Max(FMath::RoundToInt(Pane.Rect.Size01.X * ViewportSize.X * ResolutionScale), 16),
+		FMath::Max(FMath::RoundToInt(Pane.Rect.Size01.Y * ViewportSize.Y * ResolutionScale), 16));
+}
+
+void FVMViewPaneSet::ResizeRenderTarget(FVMViewPaneInstance& Instance, const FVMSplitPane& Pane, const FIntPoint& ViewportSize)
+{
+	const FIntPoint TargetSize = GetRenderTargetSize(Pane, ViewportSize, Instance.ResolutionScale);
+	if (Instance.RenderTarget->SizeX != TargetSize.X || Instance.RenderTarget->SizeY != TargetSize.Y)
+	{
+		Instance.RenderTarget->ResizeTarget(TargetSize.X, TargetSize.Y);
+	}
+}
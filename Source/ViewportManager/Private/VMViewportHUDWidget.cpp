@@ -7,6 +7,7 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 #include "VMLog.h"
+#include "VMPaneCosts.h"
 
 UVMViewportHUDWidget::UVMViewportHUDWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -20,6 +21,35 @@ void UVMViewportHUDWidget::NativeOnInitialized()
 	Super::NativeOnInitialized();
 }
 
+void UVMViewportHUDWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	VM_PANE_COST_SCOPE(EVMPaneCost::HUD, LocalPlayerIndex);
+
+	PendingDeltaTime += InDeltaTime;
+	if (++FramesSinceUpdate < UpdateDivisor)
+	{
+		return;
+	}
+
+	Super::NativeTick(MyGeometry, PendingDeltaTime);
+
+	FramesSinceUpdate = 0;
+	PendingDeltaTime = 0.0f;
+}
+
+int32 UVMViewportHUDWidget::NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	VM_PANE_COST_SCOPE(EVMPaneCost::HUD, LocalPlayerIndex);
+
+	return Super::NativePaint(Args, AllottedGeometry, MyCullingRect, OutDrawElements, LayerId, InWidgetStyle, bParentEnabled);
+}
+
+void UVMViewportHUDWidget::SetUpdateDivisor(int32 InUpdateDivisor)
+{
+	UpdateDivisor = FMath::Max(InUpdateDivisor, 1);
+}
+
 void UVMViewportHUDWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
@@ -29,7 +59,7 @@ void UVMViewportHUDWidget::NativeConstruct()
 		OnViewportAssigned(LocalPlayerIndex);
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("UVMViewportHUDWidget::NativeConstruct - HUD constructed for LocalPlayer %d"), LocalPlayerIndex);
+	UE_LOG(LogVMHUD, Verbose, TEXT("UVMViewportHUDWidget::NativeConstruct - HUD constructed for LocalPlayer %d"), LocalPlayerIndex);
 }
 
 void UVMViewportHUDWidget::SetViewportInfo(int32 InLocalPlayerIndex, const FVMSplitRect& InViewportRect)
@@ -42,7 +72,7 @@ void UVMViewportHUDWidget::SetViewportInfo(int32 InLocalPlayerIndex, const FVMSp
 		OnViewportAssigned(LocalPlayerIndex);
 	}
 
-	UE_LOG(LogViewportManager, Log, TEXT("UVMViewportHUDWidget::SetViewportInfo - Set viewport info for LocalPlayer %d, Rect: (%.3f, %.3f, %.3f, %.3f)"), 
+	UE_LOG(LogVMHUD, Verbose, TEXT("UVMViewportHUDWidget::SetViewportInfo - Set viewport info for LocalPlayer %d, Rect: (%.3f, %.3f, %.3f, %.3f)"), 
 		LocalPlayerIndex, ViewportRect.Origin01.X, ViewportRect.Origin01.Y, ViewportRect.Size01.X, ViewportRect.Size01.Y);
 }
 
@@ -8,6 +8,12 @@ UVMViewportManagerSettings::UVMViewportManagerSettings()
 {
 	bApplyDefaultLayoutOnWorldInit = true;
 	bAutoAddMissingLocalPlayers = true;
+	bUseStagedLayoutApply = false;
+	StagedApplyFrameBudgetMs = 4.0f;
+	MaxPooledHUDWidgetsPerClass = 8;
+	MaxPooledPawnsPerClass = 4;
+	PanePixelBudgetMegapixels = 8.3f;
+	bCoalesceMouseAxisInput = false;
 }
 
 FName UVMViewportManagerSettings::GetCategoryName() const
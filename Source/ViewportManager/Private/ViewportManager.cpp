@@ -9,6 +9,7 @@
 #include "Misc/ConfigCacheIni.h"
 #include "Misc/Paths.h"
 #include "VMGameViewportClient.h"
+#include "VMStats.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Styling/AppStyle.h"
 #include "Widgets/SWindow.h"
@@ -24,6 +25,35 @@
 #endif
 
 DEFINE_LOG_CATEGORY(LogViewportManager);
+DEFINE_LOG_CATEGORY(LogVMLayout);
+DEFINE_LOG_CATEGORY(LogVMInput);
+DEFINE_LOG_CATEGORY(LogVMCamera);
+DEFINE_LOG_CATEGORY(LogVMHUD);
+DEFINE_LOG_CATEGORY(LogVMEditor);
+
+LLM_DEFINE_TAG(ViewportManager);
+LLM_DEFINE_TAG(ViewportManager_Layout, TEXT("Layout"), TEXT("ViewportManager"));
+LLM_DEFINE_TAG(ViewportManager_HUD, TEXT("HUD"), TEXT("ViewportManager"));
+LLM_DEFINE_TAG(ViewportManager_Pawns, TEXT("Pawns"), TEXT("ViewportManager"));
+LLM_DEFINE_TAG(ViewportManager_Designer, TEXT("Designer"), TEXT("ViewportManager"));
+LLM_DEFINE_TAG(ViewportManager_Undo, TEXT("Undo"), TEXT("ViewportManager_Designer"));
+
+DEFINE_STAT(STAT_VM_ApplyLayout);
+DEFINE_STAT(STAT_VM_LayoutPlayers);
+DEFINE_STAT(STAT_VM_SpawnAndPossessPawns);
+DEFINE_STAT(STAT_VM_SetupViewportHUDs);
+DEFINE_STAT(STAT_VM_InputKey);
+DEFINE_STAT(STAT_VM_InputAxis);
+DEFINE_STAT(STAT_VM_CameraPawnTick);
+DEFINE_STAT(STAT_VM_CameraUpdateSubsystem);
+DEFINE_STAT(STAT_VM_InputEventsIn);
+DEFINE_STAT(STAT_VM_InputEventsRouted);
+DEFINE_STAT(STAT_VM_Panes);
+DEFINE_STAT(STAT_VM_DormantPanes);
+DEFINE_STAT(STAT_VM_LiveHUDs);
+DEFINE_STAT(STAT_VM_PanePawns);
+
+UE_TRACE_CHANNEL_DEFINE(ViewportManagerChannel);
 
 #define LOCTEXT_NAMESPACE "FViewportManagerModule"
 
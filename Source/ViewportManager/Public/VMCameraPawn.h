@@ -7,6 +7,8 @@
 #include "Camera/CameraComponent.h"
 #include "GameFramework/SpringArmComponent.h"
 #include "InputActionValue.h"
+#include "WorldCollision.h"
+#include "VMCameraSmoothing.h"
 #include "VMCameraPawn.generated.h"
 
 class UInputMappingContext;
@@ -43,6 +45,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -138,6 +141,13 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced Settings")
 	bool bDisableViewportFocusing = true;
 
+	/** Collision channel of the click-to-focus trace. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced Settings", meta = (EditCondition = "!bDisableViewportFocusing"))
+	TEnumAsByte<ECollisionChannel> FocusTraceChannel = ECC_Visibility;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced Settings", meta = (EditCondition = "!bDisableViewportFocusing", ClampMin = "100.0"))
+	float FocusTraceLength = 10000.0f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced Settings")
 	bool bUseDistanceBasedZoom = true;
 
@@ -147,6 +157,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced Settings")
 	bool bUseSmoothMovement = false;
 
+	/** Spring frequency for orbit, pan and zoom; higher settles faster (roughly 2.5 / speed seconds). */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Advanced Settings", meta = (EditCondition = "bUseSmoothMovement", ClampMin = "0.1", ClampMax = "20.0"))
 	float SmoothMovementSpeed = 5.0f;
 
@@ -164,6 +175,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Camera Control")
 	void SetFocusPoint(FVector World);
 
+	/** Moves the focus to a tracked target's location, through the smoother when smooth movement is on. */
+	void FollowTarget(const FVector& TargetLocation);
+
+	UFUNCTION(BlueprintCallable, Category = "Camera Control", BlueprintPure)
+	bool IsSmoothing() const { return Smoother.IsAwake(); }
+
+	/**
+	 * Stops or resumes target tracking while a hidden pane or the pawn pool has the pawn asleep. Call after the
+	 * generic tick reset: waking turns the tick back on if the pawn is mid-smooth or tracks its own target.
+	 */
+	void SetCameraAsleep(bool bAsleep);
+
+	/**
+	 * Moves target tracking between the world's camera update subsystem and the pawn's own tick.
+	 * Only takes effect after BeginPlay and in worlds that have the subsystem.
+	 */
+	void SetUseCameraUpdateSubsystem(bool bUse);
+
 	UFUNCTION(BlueprintCallable, Category = "Camera Control")
 	void SetTargetActor(AActor* Actor);
 
@@ -281,20 +310,42 @@ protected:
 	float DefaultPanSpeed = 100.0f;
 	float DefaultZoomSpeed = 10.0f;
 
-	FVector TargetLocation;
-	FRotator TargetRotation;
-	float TargetOrbitDistance;
-	bool bIsMovingToTarget = false;
+	// Drives orbit, pan and zoom while bUseSmoothMovement is set; the pawn only ticks while it is awake
+	FVMCameraSmoother Smoother;
 
 	FVector StartingLocation;
 	FRotator StartingRotation;
 	void UpdateCameraProjection();
 	void UpdateTargetTracking();
 	void UpdateSmoothMovement(float DeltaTime);
+	bool NeedsTick() const;
+	FVMCameraSmoothingState& BeginSmoothing();
+	void StopSmoothing();
+	FVMCameraSmoothingState ReadSmoothingState() const;
+	void ApplySmoothingState(const FVMCameraSmoothingState& State);
 	FVector GetCameraRightVector() const;
 	FVector GetCameraUpVector() const;
 	FVector GetCurrentFocusPoint() const;
 	void SetupStartingPosition();
+
+	// Click-to-focus traces run asynchronously and land next frame; only the latest one is applied
+	FTraceHandle PendingFocusTrace;
+	FTraceDelegate FocusTraceDelegate;
+	void OnFocusTraceDone(const FTraceHandle& TraceHandle, FTraceDatum& TraceDatum);
+	void CancelFocusTrace();
+	bool IsInFocusedPane() const;
+
+	/** Pushes target and tracking changes to the world's camera update subsystem. */
+	void RefreshCameraUpdate();
+
+	// Target tracking runs in UVMCameraUpdateSubsystem; the pawn only ticks itself in worlds without one
+	bool bTrackedByCameraUpdateSubsystem = false;
+
+	// Set while dormant or parked; the subsystem drops the pawn so hidden cameras are never moved
+	bool bCameraAsleep = false;
+
+	// Blueprint subclass implements Event Tick, so the pawn keeps ticking even while batched
+	bool bTicksForBlueprint = false;
 };
 
 
@@ -0,0 +1,66 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Every channel an orbit camera smooths. Yaw is unwound so the spring never takes the long way round. */
+struct FVMCameraSmoothingState
+{
+	FVector Focus = FVector::ZeroVector;
+	float Yaw = 0.0f;
+	float Pitch = 0.0f;
+	float ArmLength = 0.0f;
+
+	/** Field of view in degrees, or ortho width for orthographic cameras. */
+	float Zoom = 0.0f;
+};
+
+/**
+ * Critically damped springs pulling a camera state toward a goal. Integration runs in fixed
+ * substeps with the exact spring solution, so the same elapsed time produces bit-identical
+ * results at any frame rate. Once every channel has converged the smoother snaps to the goal
+ * and sleeps until the goal changes.
+ */
+struct VIEWPORTMANAGER_API FVMCameraSmoother
+{
+	static constexpr float StepSeconds = 1.0f / 240.0f;
+
+	/** Longest frame advanced in full; longer hitches are clamped rather than spiralling into substeps. */
+	static constexpr float MaxAdvanceSeconds = 0.25f;
+
+	FVMCameraSmoother();
+
+	/** Spring angular frequency in 1/s; a critically damped spring settles in roughly 5 / Frequency seconds. */
+	void SetFrequency(float InFrequency);
+
+	/** Jumps to State with zero velocity and goes to sleep. */
+	void Reset(const FVMCameraSmoothingState& State);
+
+	/** Goal to modify in place; wakes the smoother. */
+	FVMCameraSmoothingState& EditGoal();
+
+	const FVMCameraSmoothingState& GetGoal() const { return Goal; }
+	const FVMCameraSmoothingState& GetCurrent() const { return Current; }
+
+	bool IsAwake() const { return bAwake; }
+
+	/** Advances by DeltaTime in fixed substeps. Returns true while still moving. */
+	bool Advance(float DeltaTime);
+
+	int32 GetTotalSteps() const { return TotalSteps; }
+
+private:
+	void Step();
+	bool HasConverged() const;
+
+	FVMCameraSmoothingState Current;
+	FVMCameraSmoothingState Goal;
+	FVMCameraSmoothingState Velocity;
+
+	float Frequency = 10.0f;
+	float StepDecay = 1.0f;
+	double Accumulator = 0.0;
+	int32 TotalSteps = 0;
+	bool bAwake = false;
+};
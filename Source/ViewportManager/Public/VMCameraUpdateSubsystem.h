@@ -0,0 +1,65 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VMCameraUpdateSubsystem.generated.h"
+
+class AVMCameraPawn;
+
+/**
+ * Target tracking state for a set of camera pawns, held in parallel arrays so one update
+ * walks every camera without an actor tick each. A camera only moves when its target has
+ * moved by more than the tracking tolerance since it was last written.
+ */
+struct VIEWPORTMANAGER_API FVMCameraUpdateBatch
+{
+	void Add(AVMCameraPawn* Camera);
+	void Remove(AVMCameraPawn* Camera);
+
+	/** Re-reads the camera's target and tracking flags; call whenever either changes. */
+	void Refresh(AVMCameraPawn* Camera);
+
+	/** Polls every tracked target, then moves the cameras whose target moved. Returns how many moved. */
+	int32 Update();
+
+	int32 Num() const { return Cameras.Num(); }
+
+private:
+	TArray<TWeakObjectPtr<AVMCameraPawn>> Cameras;
+	TArray<TWeakObjectPtr<AActor>> Targets;
+	TArray<FVector> FocusPoints;
+
+	// Slots whose focus point changed during the current update
+	TArray<int32> MovedSlots;
+};
+
+/** Updates every AVMCameraPawn of a world from one tick instead of one actor tick per pawn. */
+UCLASS()
+class VIEWPORTMANAGER_API UVMCameraUpdateSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	void RegisterCamera(AVMCameraPawn* Camera) { Batch.Add(Camera); }
+	void UnregisterCamera(AVMCameraPawn* Camera) { Batch.Remove(Camera); }
+	void RefreshCamera(AVMCameraPawn* Camera) { Batch.Refresh(Camera); }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	int32 GetNumCameras() const { return Batch.Num(); }
+
+	/** Cameras moved by the most recent tick. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	int32 GetLastMovedCameras() const { return LastMovedCameras; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FVMCameraUpdateBatch Batch;
+	int32 LastMovedCameras = 0;
+};
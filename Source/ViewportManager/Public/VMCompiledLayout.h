@@ -0,0 +1,59 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMSplitLayoutAsset.h"
+
+/** Result of a hit test against a compiled layout. */
+struct FVMPaneHit
+{
+	int32 LocalPlayerIndex = INDEX_NONE;
+	int32 PaneIndex = INDEX_NONE;
+	bool bReceivesKeyboardMouse = false;
+
+	bool IsValid() const { return LocalPlayerIndex != INDEX_NONE; }
+};
+
+/**
+ * Immutable, flattened view of a layout asset built once per ApplyLayout.
+ * Rects are stored as parallel arrays ordered top-most first, so a hit test is a
+ * single forward scan that returns the first containing pane without touching the
+ * asset or any map. Later panes in the asset draw over earlier ones (picture-in-picture).
+ */
+class VIEWPORTMANAGER_API FVMCompiledLayout
+{
+public:
+	enum EPaneFlags : uint8
+	{
+		None					= 0,
+		ReceivesKeyboardMouse	= 1 << 0
+	};
+
+	/** Rebuilds from the asset, applying the same filtering rules as ApplyLayout (no UI-only or view-only panes, negative or duplicate indices). */
+	void Compile(const UVMSplitLayoutAsset& Layout);
+
+	void Reset();
+
+	FVMPaneHit FindPaneAt(const FVector2D& ScreenPosition01) const;
+
+	/** Slot of the entry that owns LocalPlayerIndex, or INDEX_NONE. */
+	int32 FindSlotForPlayer(int32 LocalPlayerIndex) const;
+
+	int32 Num() const { return LocalPlayerIndices.Num(); }
+	bool IsEmpty() const { return LocalPlayerIndices.Num() == 0; }
+
+	int32 GetLocalPlayerIndex(int32 Slot) const { return LocalPlayerIndices[Slot]; }
+	int32 GetPaneIndex(int32 Slot) const { return PaneIndices[Slot]; }
+	uint8 GetFlags(int32 Slot) const { return Flags[Slot]; }
+	FVMSplitRect GetRect(int32 Slot) const;
+
+private:
+	TArray<float> MinX;
+	TArray<float> MinY;
+	TArray<float> MaxX;
+	TArray<float> MaxY;
+	TArray<int32> LocalPlayerIndices;
+	TArray<int32> PaneIndices;
+	TArray<uint8> Flags;
+};
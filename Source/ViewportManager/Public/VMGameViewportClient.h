@@ -4,13 +4,234 @@
 
 #include "CoreMinimal.h"
 #include "Engine/GameViewportClient.h"
+#include "Engine/StreamableManager.h"
 #include "VMSplitLayoutAsset.h"
+#include "VMCompiledLayout.h"
+#include "VMHUDWidgetPool.h"
+#include "VMPawnPool.h"
+#include "VMViewPanes.h"
+#include "VMMirrorPanes.h"
+#include "VMPaneRenderProfile.h"
+#include "VMInputRouting.h"
+#include "VMPaneCosts.h"
 #include "VMGameViewportClient.generated.h"
 
+class UCurveFloat;
+class APlayerController;
+class FVMPaneSceneViewExtension;
+
+
+/** What the most recent ApplyLayout call actually touched. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMLayoutApplyStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	bool bIncremental = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	bool bStaged = false;
+
+	/** Frames a staged apply was spread across; 0 for synchronous applies. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 StagedFrames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 RectsUpdated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 LocalPlayersCreated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PawnsSpawned = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PawnsDestroyed = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PawnsReused = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PawnsParked = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PawnsConfigured = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 HUDsCreated = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 HUDsReused = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 HUDsRemoved = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 HUDsRepositioned = 0;
+
+	int32 GetTotalTouched() const
+	{
+		return RectsUpdated + LocalPlayersCreated + PawnsSpawned + PawnsDestroyed + PawnsReused + PawnsParked + PawnsConfigured
+			+ HUDsCreated + HUDsReused + HUDsRemoved + HUDsRepositioned;
+	}
+};
+
+/** How often one pane of the current layout actually updated. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMPaneUpdateStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PaneIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 LocalPlayerIndex = INDEX_NONE;
+
+	/** Divisor in effect this frame; 1 while the pane is focused. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 UpdateDivisor = 1;
+
+	/** Updates during the last full one-second window. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	float UpdatesPerSecond = 0.0f;
+
+	/** Frames this pane updated since the layout was applied. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 TotalUpdates = 0;
+
+	int32 UpdatesInWindow = 0;
+};
+
+/** Mouse axis events received versus dispatched to player controllers while coalescing. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMInputCoalescingStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 LastFrameEventsIn = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 LastFrameDispatchesOut = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 TotalEventsIn = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 TotalDispatchesOut = 0;
+};
+
+/** The pawn and HUD behind one pane, with an estimate of the UObject memory each holds. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMPaneMemoryStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 PaneIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 LocalPlayerIndex = INDEX_NONE;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	bool bDormant = false;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	bool bHasPawn = false;
+
+	/** The pawn and its components. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 PawnBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	bool bHasHUD = false;
+
+	/** The widget and its widget tree; Slate widgets are not included. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 HUDBytes = 0;
+};
+
+/** Memory held outside individual panes: the layout, the HUD root, both pools and pane-class objects nothing tracks. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMMemoryStats
+{
+	GENERATED_BODY()
+
+	/** The applied layout asset plus the viewport client's copies of it. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 LayoutBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 HUDRootBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 IdleHUDs = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 IdleHUDBytes = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 IdlePawns = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 IdlePawnBytes = 0;
+
+	/** Live top-level widgets of a pane HUD class that no pane shows and the pool does not hold. After a GC these are leaks. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 UntrackedHUDs = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 UntrackedHUDBytes = 0;
+
+	/** Pawns of a pane pawn class in the world that no pane's player possesses and the pool has not parked. */
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 UntrackedPawns = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int64 UntrackedPawnBytes = 0;
+};
 
 // Delegate for when focus changes between viewports
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FVMFocusChangedDelegate, int32, OldPlayerIndex, int32, NewPlayerIndex);
 
+// Delegate for when every pane of a layout is online (immediately for synchronous applies)
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FVMLayoutApplyCompleteDelegate, UVMSplitLayoutAsset*, LayoutAsset);
+
+enum class EVMStagedApplyStep : uint8
+{
+	CreatePlayer,
+	SpawnPawn,
+	CreateHUD
+};
+
+struct FVMStagedApplyEntry
+{
+	EVMStagedApplyStep Step;
+	int32 PaneIndex;
+};
+
+/** What was put to sleep for a local player whose pane is hidden, so exactly that can be woken again. */
+struct FVMDormantPane
+{
+	TWeakObjectPtr<APlayerController> Controller;
+	TWeakObjectPtr<APawn> Pawn;
+	TWeakObjectPtr<UUserWidget> HUD;
+};
+
+/** Mouse axis deltas for one pane and key, summed over a frame and dispatched as a single event. */
+struct FVMPendingAxisInput
+{
+	FVMPendingAxisInput(int32 InLocalPlayerIndex, const FInputKeyEventArgs& InArgs)
+		: LocalPlayerIndex(InLocalPlayerIndex), Args(InArgs)
+	{
+	}
+
+	int32 LocalPlayerIndex;
+	FInputKeyEventArgs Args;
+};
+
 UCLASS(BlueprintType)
 class VIEWPORTMANAGER_API UVMGameViewportClient : public UGameViewportClient
 {
@@ -22,6 +243,12 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "Viewport Manager|Events")
 	FVMFocusChangedDelegate OnFocusChanged;
 
+	UPROPERTY(BlueprintAssignable, Category = "Viewport Manager|Events")
+	FVMLayoutApplyCompleteDelegate OnLayoutApplyComplete;
+
+	virtual void BeginDestroy() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual void PostRender(UCanvas* Canvas) override;
 	virtual void LayoutPlayers() override;
 	virtual bool InputKey(const FInputKeyEventArgs& EventArgs) override;
 	virtual bool InputAxis(const FInputKeyEventArgs& EventArgs) override;
@@ -29,9 +256,109 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
 	void ApplyLayout(UVMSplitLayoutAsset* LayoutAsset);
 
+	/** Applies a layout over several frames, spending at most FrameBudgetMs per frame on player, pawn and HUD creation. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	void ApplyLayoutStaged(UVMSplitLayoutAsset* LayoutAsset, float FrameBudgetMs = 4.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager", BlueprintPure)
+	bool IsStagedApplyPending() const;
+
+	/**
+	 * Applies a layout once, then animates pane rects and HUD anchors from where they are on screen
+	 * to the new layout over Duration seconds. Curve maps normalized time to blend alpha (smoothstep when null).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	void TransitionToLayout(UVMSplitLayoutAsset* LayoutAsset, float Duration = 0.3f, UCurveFloat* Curve = nullptr);
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager", BlueprintPure)
+	bool IsLayoutTransitionActive() const { return TransitionDuration > 0.0; }
+
 	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
 	void RefreshLayout();
 
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager", BlueprintPure)
+	UVMSplitLayoutAsset* GetCurrentLayout() const { return CurrentLayoutAsset; }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	FVMLayoutApplyStats GetLastApplyStats() const { return LastApplyStats; }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	FVMHUDWidgetPoolStats GetHUDPoolStats() const { return HUDPool.GetStats(); }
+
+	/** Resolution scale per pane of the current layout, as resolved from each pane's ResolutionPolicy. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	TArray<float> GetPaneResolutionScales() const { return PaneResolutionScales; }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	FVMPawnPoolStats GetPawnPoolStats() const { return PawnPool.GetStats(); }
+
+	/** One entry per pane of the current layout. Walks each pawn's and HUD's subobjects, so not for every frame. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats")
+	TArray<FVMPaneMemoryStats> GetPaneMemoryStats() const;
+
+	/** Iterates every live widget and every pawn in the world; meant for reports, not for every frame. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats")
+	FVMMemoryStats GetMemoryStats() const;
+
+	/** Overrides the update divisor of the panes showing LocalPlayerIndex until the next layout is applied. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Performance")
+	void SetPaneUpdateDivisor(int32 LocalPlayerIndex, int32 UpdateDivisor);
+
+	/** Configured divisor of the first pane showing LocalPlayerIndex, ignoring focus; 1 when there is none. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Performance", BlueprintPure)
+	int32 GetPaneUpdateDivisor(int32 LocalPlayerIndex) const;
+
+	/** Local players whose pane is absent or zero-size, with their controller, pawn and HUD asleep. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	int32 GetNumDormantPanes() const { return DormantPanes.Num(); }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	bool IsPaneDormant(int32 LocalPlayerIndex) const { return DormantPanes.Contains(LocalPlayerIndex); }
+
+	/** One entry per pane of the current layout. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	TArray<FVMPaneUpdateStats> GetPaneUpdateStats() const { return PaneUpdateStats; }
+
+	/**
+	 * Sums mouse axis events per pane and key and dispatches each sum once per frame, before the world ticks.
+	 * Keyboard and mouse button events flush the pending sums first so their ordering is kept.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Performance")
+	void SetMouseAxisCoalescingEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Performance", BlueprintPure)
+	bool IsMouseAxisCoalescingEnabled() const { return bCoalesceMouseAxisInput; }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Stats", BlueprintPure)
+	FVMInputCoalescingStats GetInputCoalescingStats() const { return InputCoalescingStats; }
+
+	/**
+	 * Routes a device's events with Policy, overriding the layout's routing across pane edits and re-applies
+	 * until ResetInputRoutes. GamepadIndex is only used for gamepads and LocalPlayerIndex only for the Fixed policy.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Input")
+	void SetInputRoute(EVMInputDeviceType Device, int32 GamepadIndex, EVMInputRoutingPolicy Policy, int32 LocalPlayerIndex = -1);
+
+	/** Returns false for gamepads left to the engine's controller id routing. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Input", BlueprintPure)
+	bool GetInputRoute(EVMInputDeviceType Device, int32 GamepadIndex, FVMInputRoute& OutRoute) const;
+
+	/** Hands a gamepad back to the engine's controller id routing, overriding the layout until ResetInputRoutes. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Input")
+	void ClearGamepadRoute(int32 GamepadIndex) { InputRouting.ClearGamepadRoute(GamepadIndex); }
+
+	/** Drops every route set with SetInputRoute or ClearGamepadRoute and routes by the current layout again. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Input")
+	void ResetInputRoutes();
+
+	bool HasRenderProfiles() const { return bHasRenderProfiles; }
+
+	/** Show flag overrides every player pane's render profile agrees on; applied to the shared view family. */
+	const TArray<FEngineShowFlagsSetting>& GetSharedRenderShowFlags() const { return SharedRenderShowFlags; }
+
+	/** Render profile of the player pane whose local player uses ControllerId, as stored in FSceneView::PlayerIndex. */
+	const UVMPaneRenderProfile* FindRenderProfileForController(int32 ControllerId) const;
+
 	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
 	void SetActiveLocalPlayer(int32 LocalPlayerIndex);
 
@@ -59,6 +386,28 @@ protected:
 
 	TMap<int32, FVMSplitRect> PlayerRects;
 
+	// Flattened copy of PlayerRects plus per-pane flags, rebuilt by ApplyLayout and used for input routing.
+	FVMCompiledLayout CompiledLayout;
+
+	// Pane settings as of the last ApplyLayout; diffed against the asset to apply only what changed.
+	TArray<FVMSplitPane> AppliedPanes;
+
+	TWeakObjectPtr<UWorld> AppliedWorld;
+
+	FVMLayoutApplyStats LastApplyStats;
+
+	// Rect each player is animating from; LayoutPlayers blends these toward PlayerRects while a transition runs
+	TMap<int32, FVMSplitRect> TransitionFromRects;
+	double TransitionStartTime = 0.0;
+	double TransitionDuration = 0.0;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UCurveFloat> TransitionCurve;
+
+	TArray<FVMStagedApplyEntry> StagedApplySteps;
+	int32 NextStagedApplyStep = 0;
+	double StagedApplyBudgetSeconds = 0.004;
+
 	int32 ActiveKeyboardMouseLP = 0;
 
 	int32 FocusedPlayerIndex = 0;
@@ -67,10 +416,29 @@ protected:
 
 	bool bFocusHighlightingEnabled = false;
 
+	// Pane classes streamed on first visibility, keyed by LocalPlayerIndex; the pane shows a placeholder meanwhile
+	FStreamableManager PaneClassStreamer;
+	TMap<int32, TSharedPtr<FStreamableHandle>> DeferredPaneClassLoads;
+
+	/** Null when the camera mode's built-in pawn should be used. */
+	static TSoftClassPtr<APawn> ResolvePawnClassRef(const FVMSplitPane& Pane);
+
+	/** Returns nullptr when the class is still streaming for an OnFirstVisibility pane. */
 	TSubclassOf<APawn> ResolvePawnClass(const FVMSplitPane& Pane) const;
 
+	static UClass* LoadPaneClass(const FSoftObjectPath& ClassPath, EVMPaneClassLoadPolicy LoadPolicy);
+	bool RequestDeferredPaneClasses(const FVMSplitPane& Pane);
+	void OnDeferredPaneClassesLoaded(int32 LocalPlayerIndex);
+	void CancelDeferredPaneClassLoads();
+	void DrawPanePlaceholder(UCanvas* Canvas, const FVMSplitPane& Pane) const;
+
 	void ConfigurePawnForPane(APawn* Pawn, const FVMSplitPane& Pane, APlayerController* PlayerController);
 
+	/** Object plus everything outered to it (components, widget trees), counted the way "obj list" does. */
+	static int64 EstimateObjectBytes(const UObject* Object);
+
+	APawn* GetPanePawn(int32 LocalPlayerIndex) const;
+
 	UPROPERTY(Transient)
 	UUserWidget* HUDRootWidget = nullptr;
 
@@ -80,14 +448,126 @@ protected:
 	UPROPERTY(Transient)
 	TMap<int32, TWeakObjectPtr<UUserWidget>> ActivePaneHUDs;
 
+	// Detached pane HUDs kept for reuse across layout changes
+	UPROPERTY(Transient)
+	FVMHUDWidgetPool HUDPool;
+
+	TArray<float> PaneResolutionScales;
+
+	// r.ScreenPercentage before player panes first asked for a reduced resolution; restored when none do
+	float SavedScreenPercentage = 100.0f;
+	bool bOverridingScreenPercentage = false;
+
+	// Layout and viewport size the pane rendering was last rebuilt for; rect-only edits of that layout just rescale
+	TWeakObjectPtr<const UVMSplitLayoutAsset> RenderedLayout;
+	FIntPoint RenderedViewportSize = FIntPoint::ZeroValue;
+
+	// Registered once the first layout with render profiles is applied
+	TSharedPtr<FVMPaneSceneViewExtension, ESPMode::ThreadSafe> PaneViewExtension;
+	TArray<FEngineShowFlagsSetting> SharedRenderShowFlags;
+	bool bHasRenderProfiles = false;
+
+	// Scene captures backing the layout's view-only panes
+	UPROPERTY(Transient)
+	FVMViewPaneSet ViewPanes;
+
+	// Panes drawing another pane's image instead of rendering their own
+	UPROPERTY(Transient)
+	FVMMirrorPaneSet MirrorPanes;
+
+	// Pane pawns parked when a pane switches pawn class, reused instead of spawning
+	FVMPawnPool PawnPool;
+
+	// Keyed by LocalPlayerIndex; maintained by LayoutPlayers
+	TMap<int32, FVMDormantPane> DormantPanes;
+
+	// Runtime update divisor per pane of the current layout, seeded from each pane's UpdateDivisor
+	TArray<int32> PaneUpdateDivisors;
+	TBitArray<> PanesDueThisFrame;
+	TArray<FVMPaneUpdateStats> PaneUpdateStats;
+	uint64 PaneUpdateFrame = 0;
+	double PaneUpdateWindowStart = 0.0;
+	int32 PaneUpdateWindowFrames = 0;
+
+	// Average frame time over the last stats window, used to turn divisors into tick intervals
+	float ThrottleFrameTime = 1.0f / 60.0f;
+
+	// Device to pane routing, rebuilt with the compiled layout
+	FVMInputRoutingTable InputRouting;
+
+	FVMPaneHit FindHoveredPane(FVector2D& OutPosition01) const;
+	FVMPaneHit FindTransitioningPaneAt(const FVector2D& Position01) const;
+
+#if STATS
+	void UpdateStatCounters() const;
+#endif
+#if VM_WITH_PANE_COSTS
+	void DrawPaneCosts(UCanvas* Canvas) const;
+	void SyncControllerTickTimers();
+
+	// One per local player while pane costs are collected, keyed by local player index
+	TMap<int32, TUniquePtr<FVMControllerTickTimer>> ControllerTickTimers;
+#endif
+	/**
+	 * RoutingTimer holds the route lookup so far and is attributed to the pane the event goes to.
+	 * HoveredPane is a hit test the caller already ran for this event, reused by the Hover policy.
+	 */
+	bool RouteInput(const FVMInputRoute& Route, const FInputKeyEventArgs& EventArgs, bool bAxis, FVMPaneCostTimer& RoutingTimer, const FVMPaneHit* HoveredPane = nullptr);
+
+	// Mouse axis input held until the start of the next world tick while coalescing
+	bool bCoalesceMouseAxisInput = false;
+	TArray<FVMPendingAxisInput> PendingAxisInputs;
+	FVMInputCoalescingStats InputCoalescingStats;
+	int32 AxisEventsThisFrame = 0;
+	int32 AxisDispatchesThisFrame = 0;
+	FDelegateHandle WorldTickStartHandle;
+
+	bool DispatchToPlayer(int32 LocalPlayerIndex, const FInputKeyEventArgs& EventArgs);
+	void QueueAxisInput(int32 LocalPlayerIndex, const FInputKeyEventArgs& EventArgs);
+	void FlushPendingAxisInput();
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	void RebuildPaneRendering();
+	bool NeedsPaneRenderingRebuild(const UVMSplitLayoutAsset& LayoutAsset) const;
+	void UpdatePaneResolution();
+	void ApplyPaneResolutionScales();
+	void ApplyPaneRenderProfiles();
+	void ResetPaneUpdateSchedule();
+	void UpdatePaneSchedule();
+	int32 GetEffectiveUpdateDivisor(int32 PaneIndex) const;
+	void ApplyPaneTickThrottling();
+	void ThrottleActorTicks(AActor* Actor, int32 UpdateDivisor) const;
+	void UpdatePaneDormancy(UGameInstance* LocalGameInstance, int32 LocalPlayerIndex, bool bHidden);
+	void WakeAllDormantPanes();
+	static void SetActorDormant(AActor* Actor, bool bDormant);
+	static void SetHUDDormant(UUserWidget* HUD, bool bDormant);
 	void EnsureHUDRoot();
 	void ClearPaneHUDs();
+	void RemovePaneHUD(int32 LocalPlayerIndex);
+	int32 RebuildPlayerRects(UVMSplitLayoutAsset* LayoutAsset);
+	void ProcessStagedApply();
+	void FinishStagedApply();
+	void CancelStagedApply();
+	void StopLayoutTransition();
 	void EnsureLocalPlayersExist();
+	void EnsureLocalPlayerExists(int32 LocalPlayerIndex);
 	void SpawnAndPossessPawns();
+	void SpawnAndPossessPawnForPane(const FVMSplitPane& Pane);
 	void SetupViewportHUDs();
-	void HandleClickToFocus(const FVector2D& ScreenPosition);
-	int32 FindPaneAtScreenPosition(const FVector2D& ScreenPosition) const;
+	void CreatePaneHUD(const FVMSplitPane& Pane);
+	void UpdatePaneHUDRect(int32 LocalPlayerIndex, const FVMSplitRect& Rect);
+	bool CanApplyIncrementally(const UVMSplitLayoutAsset& LayoutAsset) const;
+	void ApplyLayoutDelta();
+	static bool HasPawnSettingsChanged(const FVMSplitPane& Pane, const FVMSplitPane& Previous);
+	static bool HasRenderSettingsChanged(const FVMSplitPane& Pane, const FVMSplitPane& Previous);
+	static void ApplyHUDSlotRect(class UCanvasPanelSlot* Slot, const FVMSplitRect& Rect);
+	static int32 GetMaxPooledHUDsPerClass();
+	static int32 GetMaxPooledPawnsPerClass();
+	/** Focuses the clicked pane's local player, as found by the caller's hit test. */
+	void HandleClickToFocus(int32 PaneIndex);
+	const FVMSplitPane* FindPaneForPlayer(int32 LocalPlayerIndex) const;
 	void EnsureCursorVisibility();
+	void ApplyCursorVisibility(int32 LocalPlayerIndex);
 };
 
 
@@ -0,0 +1,71 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Blueprint/UserWidget.h"
+#include "VMHUDWidgetPool.generated.h"
+
+class APlayerController;
+
+/** Cumulative reuse counters for the pane HUD widget pool. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMHUDWidgetPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Reuses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Misses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Released = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Evicted = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 IdleWidgets = 0;
+};
+
+USTRUCT()
+struct FVMHUDWidgetPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUserWidget>> IdleWidgets;
+};
+
+/**
+ * Idle pane HUD widgets kept per class so layout changes can reattach them
+ * instead of constructing a new widget tree for every pane.
+ */
+USTRUCT()
+struct VIEWPORTMANAGER_API FVMHUDWidgetPool
+{
+	GENERATED_BODY()
+
+	/** Returns an idle widget of exactly WidgetClass, rebound to OwningPlayer, or nullptr on a miss. */
+	UUserWidget* Acquire(TSubclassOf<UUserWidget> WidgetClass, APlayerController* OwningPlayer);
+
+	/** Detaches Widget and keeps it for reuse while its class has fewer than MaxIdlePerClass idle widgets. */
+	void Release(UUserWidget* Widget, int32 MaxIdlePerClass);
+
+	/** Drops every idle widget, e.g. when their owning players belong to a previous world. */
+	void Reset();
+
+	void NoteMiss() { ++Stats.Misses; }
+
+	FVMHUDWidgetPoolStats GetStats() const;
+
+	void GetIdleWidgets(TArray<UUserWidget*>& OutWidgets) const;
+
+private:
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FVMHUDWidgetPoolBucket> Buckets;
+
+	FVMHUDWidgetPoolStats Stats;
+};
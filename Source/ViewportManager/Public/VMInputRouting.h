@@ -0,0 +1,73 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMSplitLayoutAsset.h"
+#include "VMInputRouting.generated.h"
+
+class FVMCompiledLayout;
+struct FInputKeyEventArgs;
+
+/** Where the events of one input device go. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMInputRoute
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport Manager|Input")
+	EVMInputRoutingPolicy Policy = EVMInputRoutingPolicy::Hover;
+
+	/** Target of the Fixed policy. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport Manager|Input")
+	int32 LocalPlayerIndex = INDEX_NONE;
+};
+
+/**
+ * Input route per device, built from the layout on every apply. Keyboard and mouse hold one route
+ * each and gamepads are indexed by controller id, so finding the route of an event is a lookup;
+ * only the Hover policy needs a hit test, and only for the events it routes.
+ *
+ * Routes set at runtime are kept apart and laid over the layout's routes on every rebuild, so pane
+ * edits and re-applies keep them until ResetOverrides.
+ */
+class VIEWPORTMANAGER_API FVMInputRoutingTable
+{
+public:
+	void Rebuild(const UVMSplitLayoutAsset& Layout, const FVMCompiledLayout& Compiled);
+
+	/** Clears the layout's routes; runtime overrides are kept. */
+	void Reset();
+
+	/** Drops every runtime route; the next Rebuild routes by the layout alone. */
+	void ResetOverrides();
+
+	/** Route of the device that produced the event, or nullptr for gamepads left to the engine's controller id routing. */
+	const FVMInputRoute* FindRoute(const FInputKeyEventArgs& EventArgs) const;
+	const FVMInputRoute* FindRoute(EVMInputDeviceType Device, int32 GamepadIndex) const;
+
+	/** Runtime route; overrides the layout's route for the device until ResetOverrides. */
+	void SetRoute(EVMInputDeviceType Device, int32 GamepadIndex, const FVMInputRoute& Route);
+
+	/** Hands the gamepad back to the engine's controller id routing, even if the layout routes it. */
+	void ClearGamepadRoute(int32 GamepadIndex);
+
+	/** Local players of the panes that receive keyboard and mouse input, targets of the Broadcast policy. */
+	const TArray<int32>& GetBroadcastPlayers() const { return BroadcastPlayers; }
+
+	static EVMInputDeviceType GetDeviceType(const FInputKeyEventArgs& EventArgs);
+
+private:
+	void WriteRoute(EVMInputDeviceType Device, int32 GamepadIndex, const TOptional<FVMInputRoute>& Route);
+	void ApplyOverrides(const FVMCompiledLayout& Compiled);
+
+	FVMInputRoute KeyboardRoute;
+	FVMInputRoute MouseRoute;
+	TArray<TOptional<FVMInputRoute>> GamepadRoutes;
+	TArray<int32> BroadcastPlayers;
+
+	// Runtime routes; an unset gamepad override hands that gamepad back to the engine
+	TOptional<FVMInputRoute> KeyboardOverride;
+	TOptional<FVMInputRoute> MouseOverride;
+	TMap<int32, TOptional<FVMInputRoute>> GamepadOverrides;
+};
@@ -3,5 +3,63 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
 
-VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogViewportManager, Log, All);
+/**
+ * Everything below this verbosity is compiled out of the plugin's log calls, arguments included.
+ * Shipping builds keep errors only; override per target with a VM_LOG_COMPILE_TIME_VERBOSITY definition.
+ */
+#ifndef VM_LOG_COMPILE_TIME_VERBOSITY
+	#if UE_BUILD_SHIPPING
+		#define VM_LOG_COMPILE_TIME_VERBOSITY Error
+	#else
+		#define VM_LOG_COMPILE_TIME_VERBOSITY All
+	#endif
+#endif
+
+// Module lifecycle, Blueprint helpers, checks and benchmarks
+VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogViewportManager, Log, VM_LOG_COMPILE_TIME_VERBOSITY);
+
+// Layout apply, pane edits, pawn spawning and pane rendering
+VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogVMLayout, Log, VM_LOG_COMPILE_TIME_VERBOSITY);
+
+// Input routing, focus and input bindings
+VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogVMInput, Log, VM_LOG_COMPILE_TIME_VERBOSITY);
+
+// Camera pawns
+VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogVMCamera, Log, VM_LOG_COMPILE_TIME_VERBOSITY);
+
+// Pane HUD widgets
+VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogVMHUD, Log, VM_LOG_COMPILE_TIME_VERBOSITY);
+
+// Layout designer and input setup tools
+VIEWPORTMANAGER_API DECLARE_LOG_CATEGORY_EXTERN(LogVMEditor, Log, VM_LOG_COMPILE_TIME_VERBOSITY);
+
+/**
+ * UE_LOG that prints at most once per MinIntervalSeconds from this call site, reporting how many were
+ * dropped in between. For warnings that can fire every frame, such as during pane drags. Game thread only.
+ */
+#if NO_LOGGING
+	#define VM_LOG_RATE_LIMITED(CategoryName, Verbosity, MinIntervalSeconds, Format, ...)
+#else
+	#define VM_LOG_RATE_LIMITED(CategoryName, Verbosity, MinIntervalSeconds, Format, ...) \
+		do \
+		{ \
+			if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+			{ \
+				static double VMLastLogSeconds = -DBL_MAX; \
+				static int32 VMSuppressedLogs = 0; \
+				const double VMNowSeconds = FPlatformTime::Seconds(); \
+				if (VMNowSeconds - VMLastLogSeconds >= (MinIntervalSeconds)) \
+				{ \
+					UE_LOG(CategoryName, Verbosity, Format TEXT(" (%d similar suppressed)"), ##__VA_ARGS__, VMSuppressedLogs); \
+					VMLastLogSeconds = VMNowSeconds; \
+					VMSuppressedLogs = 0; \
+				} \
+				else \
+				{ \
+					++VMSuppressedLogs; \
+				} \
+			} \
+		} while (0)
+#endif
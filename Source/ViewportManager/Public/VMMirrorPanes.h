@@ -0,0 +1,60 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMSplitLayoutAsset.h"
+#include "VMMirrorPanes.generated.h"
+
+class FViewport;
+class UCanvas;
+class UTextureRenderTarget2D;
+struct FVMViewPaneSet;
+
+USTRUCT()
+struct FVMMirrorPaneInstance
+{
+	GENERATED_BODY()
+
+	int32 PaneIndex = INDEX_NONE;
+
+	/** Pane whose output is mirrored; always a player or view-only pane. */
+	int32 SourcePaneIndex = INDEX_NONE;
+};
+
+/**
+ * Mirror panes of a layout. A mirror draws another pane's final image scaled into its own
+ * rect, so it costs a copy and a textured quad instead of a second scene render. Mirrors of
+ * view-only panes sample the capture's render target directly; mirrors of player panes copy
+ * the source rect out of the viewport once per frame, shared by every mirror of that player.
+ */
+USTRUCT()
+struct VIEWPORTMANAGER_API FVMMirrorPaneSet
+{
+	GENERATED_BODY()
+
+	/** Index of the pane a mirror pane shows, or INDEX_NONE when its source is missing or not mirrorable. */
+	static int32 FindSourcePane(const UVMSplitLayoutAsset& Layout, const FVMSplitPane& MirrorPane);
+
+	void Rebuild(const UVMSplitLayoutAsset& Layout);
+
+	void Reset();
+
+	/**
+	 * Draws every mirror into its pane rect. Call after the scene has rendered into Viewport.
+	 * GetPlayerRect returns where a local player's view currently is on screen.
+	 */
+	void Draw(UCanvas* Canvas, FViewport* Viewport, const UVMSplitLayoutAsset& Layout, const FVMViewPaneSet& ViewPanes,
+		TFunctionRef<bool(int32 LocalPlayerIndex, FVMSplitRect& OutRect)> GetPlayerRect);
+
+	int32 Num() const { return Instances.Num(); }
+
+private:
+	UTextureRenderTarget2D* CopyPlayerView(FViewport* Viewport, int32 LocalPlayerIndex, const FIntRect& SourceRect);
+
+	TArray<FVMMirrorPaneInstance> Instances;
+
+	// Copies of mirrored player views, keyed by LocalPlayerIndex
+	UPROPERTY(Transient)
+	TMap<int32, TObjectPtr<UTextureRenderTarget2D>> PlayerViewCopies;
+};
@@ -0,0 +1,201 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Engine/EngineBaseTypes.h"
+
+class APawn;
+class APlayerController;
+
+// Per-pane cost attribution is a development tool; shipping builds compile every scope out
+#define VM_WITH_PANE_COSTS !UE_BUILD_SHIPPING
+
+/** What a pane's game-thread time was spent on. */
+enum class EVMPaneCost : uint8
+{
+	/** The player controller's actor tick. */
+	Controller,
+	Pawn,
+	HUD,
+	/** Route lookup, hover hit test and the controller's InputKey. */
+	Input,
+	Num
+};
+
+#if VM_WITH_PANE_COSTS
+
+/**
+ * Game-thread time attributed to each local player's pane, summed per frame and averaged over one-second windows.
+ * Off by default; while off, every VM_PANE_COST_SCOPE reads one bool and does nothing else. Game thread only.
+ */
+class VIEWPORTMANAGER_API FVMPaneCosts
+{
+public:
+	static constexpr int32 NumCosts = static_cast<int32>(EVMPaneCost::Num);
+
+	struct FPane
+	{
+		/** Average milliseconds per frame over the last full window. */
+		float AverageMs[NumCosts] = {};
+
+		/** Most expensive single frame of the last full window, all costs summed. */
+		float PeakMs = 0.0f;
+
+		double FrameSeconds[NumCosts] = {};
+		double WindowSeconds[NumCosts] = {};
+		double WindowPeakSeconds = 0.0;
+
+		float GetTotalMs() const;
+	};
+
+	static bool IsEnabled() { return bEnabled; }
+
+	/** Enabling starts from empty numbers; disabling also hides the overlay. */
+	static void SetEnabled(bool bInEnabled);
+
+	static bool IsOverlayVisible() { return bOverlayVisible; }
+
+	/** Showing the overlay enables collection. */
+	static void SetOverlayVisible(bool bVisible);
+
+	static void Add(int32 LocalPlayerIndex, EVMPaneCost Cost, double Seconds);
+
+	/** Closes the current frame; publishes averages once the window is a second old. Extra calls in the same frame are ignored. */
+	static void EndFrame();
+
+	/** Null for local players that have not been attributed any time since collection started. */
+	static const FPane* Find(int32 LocalPlayerIndex);
+
+	static int32 GetNumPanes() { return Panes.Num(); }
+
+	/** Index of the local player possessing Pawn, or INDEX_NONE for AI and unpossessed pawns. */
+	static int32 FindLocalPlayerIndex(const APawn* Pawn);
+
+	static const TCHAR* GetCostName(EVMPaneCost Cost);
+
+private:
+	static bool bEnabled;
+	static bool bOverlayVisible;
+	static TArray<FPane> Panes;
+	static double WindowStartSeconds;
+	static int32 WindowFrames;
+	static uint64 LastEndedFrame;
+};
+
+/** Adds the time between construction and destruction to one pane; does nothing for INDEX_NONE. */
+struct FVMPaneCostScope
+{
+	FVMPaneCostScope(int32 InLocalPlayerIndex, EVMPaneCost InCost)
+		: LocalPlayerIndex(InLocalPlayerIndex)
+		, Cost(InCost)
+		, StartCycles(InLocalPlayerIndex != INDEX_NONE ? FPlatformTime::Cycles64() : 0)
+	{
+	}
+
+	~FVMPaneCostScope()
+	{
+		if (LocalPlayerIndex != INDEX_NONE)
+		{
+			FVMPaneCosts::Add(LocalPlayerIndex, Cost, FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles));
+		}
+	}
+
+	int32 LocalPlayerIndex;
+	EVMPaneCost Cost;
+	uint64 StartCycles;
+};
+
+/** Attributes the rest of the enclosing scope to a pane. LocalPlayerIndexExpr is only evaluated while collecting. */
+#define VM_PANE_COST_SCOPE(Cost, LocalPlayerIndexExpr) \
+	const FVMPaneCostScope ANONYMOUS_VARIABLE(VMPaneCostScope)(FVMPaneCosts::IsEnabled() ? (LocalPlayerIndexExpr) : INDEX_NONE, Cost)
+
+/**
+ * Collects time spent before the pane it belongs to is known, such as input routing, across one or more
+ * Start/Stop spans, and hands it to that pane once found. Time is dropped if no pane is ever attributed.
+ */
+struct FVMPaneCostTimer
+{
+	void Start()
+	{
+		if (FVMPaneCosts::IsEnabled() && !bAttributed)
+		{
+			StartCycles = FPlatformTime::Cycles64();
+		}
+	}
+
+	void Stop()
+	{
+		if (StartCycles != 0)
+		{
+			Cycles += FPlatformTime::Cycles64() - StartCycles;
+			StartCycles = 0;
+		}
+	}
+
+	/** Stops the timer and gives everything collected to the pane; later calls add nothing. */
+	void Attribute(int32 LocalPlayerIndex, EVMPaneCost Cost)
+	{
+		Stop();
+		if (!bAttributed && Cycles != 0)
+		{
+			FVMPaneCosts::Add(LocalPlayerIndex, Cost, FPlatformTime::ToSeconds64(Cycles));
+		}
+		bAttributed = true;
+	}
+
+	uint64 StartCycles = 0;
+	uint64 Cycles = 0;
+	bool bAttributed = false;
+};
+
+/**
+ * Times one player controller's actor tick for the Controller cost, with a tick function the controller's tick
+ * waits on and one that waits on it. Ticks that become ready at the same moment can run in between, so the
+ * figure is an upper bound.
+ */
+class VIEWPORTMANAGER_API FVMControllerTickTimer
+{
+public:
+	/** Owner is the object the controller's tick holds its prerequisite on; it must outlive the timer. */
+	FVMControllerTickTimer(UObject* InOwner, APlayerController* InController, int32 InLocalPlayerIndex);
+	~FVMControllerTickTimer();
+
+	UE_NONCOPYABLE(FVMControllerTickTimer);
+
+	APlayerController* GetController() const { return Controller.Get(); }
+
+private:
+	struct FMark : public FTickFunction
+	{
+		FVMControllerTickTimer* Timer = nullptr;
+		bool bStart = false;
+
+		virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+		virtual FString DiagnosticMessage() override;
+	};
+
+	void OnMark(bool bStart);
+
+	UObject* Owner = nullptr;
+	TWeakObjectPtr<APlayerController> Controller;
+	int32 LocalPlayerIndex = INDEX_NONE;
+	FMark StartMark;
+	FMark EndMark;
+	uint64 StartCycles = 0;
+	uint64 StartFrame = 0;
+};
+
+#else
+
+#define VM_PANE_COST_SCOPE(Cost, LocalPlayerIndexExpr)
+
+struct FVMPaneCostTimer
+{
+	void Start() {}
+	void Stop() {}
+	void Attribute(int32 LocalPlayerIndex, EVMPaneCost Cost) {}
+};
+
+#endif // VM_WITH_PANE_COSTS
@@ -0,0 +1,52 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "Engine/Scene.h"
+#include "Components/SceneCaptureComponent.h"
+#include "VMPaneRenderProfile.generated.h"
+
+class FSceneView;
+struct FEngineShowFlags;
+
+/**
+ * Rendering feature tier for a pane, e.g. a cheap profile for picture-in-picture or
+ * secondary panes that turns off dynamic shadows, volumetrics and motion blur.
+ */
+UCLASS(BlueprintType)
+class VIEWPORTMANAGER_API UVMPaneRenderProfile : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Show flags forced on or off, by name (e.g. DynamicShadows, VolumetricFog, MotionBlur). */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Show Flags")
+	TArray<FEngineShowFlagsSetting> ShowFlagOverrides;
+
+	/** Multiplies LOD selection distance; values above 1 switch to lower LODs sooner. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Detail", meta = (ClampMin = "0.1", ClampMax = "10.0"))
+	float LODDistanceFactor = 1.0f;
+
+	/** Primitives beyond this distance are culled. 0 keeps the default draw distance. Applies to view-only panes. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Detail", meta = (ClampMin = "0.0", Units = "cm"))
+	float MaxViewDistance = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Process", meta = (ClampMin = "0.0", ClampMax = "1.0"))
+	float PostProcessBlendWeight = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Post Process", meta = (EditCondition = "PostProcessBlendWeight > 0"))
+	FPostProcessSettings PostProcessSettings;
+
+	void ApplyShowFlags(FEngineShowFlags& ShowFlags) const;
+
+	/** Applies the per-view parts of the profile (LOD distance and post process) to a scene view. */
+	void ApplyToView(FSceneView& View) const;
+
+	/**
+	 * Show flag overrides shared by every profile, with the same value. Player panes render in one
+	 * view family, so only flags all of them agree on can be applied; a null profile means none.
+	 */
+	static TArray<FEngineShowFlagsSetting> GetSharedShowFlagOverrides(TConstArrayView<const UVMPaneRenderProfile*> Profiles);
+};
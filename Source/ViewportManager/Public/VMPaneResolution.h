@@ -0,0 +1,23 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMSplitLayoutAsset.h"
+
+/**
+ * Resolves each pane's EVMPaneResolutionPolicy into a per-axis resolution scale
+ * (1 = native, 0.5 = half width and half height). Pure and world-free so it can
+ * be evaluated for templates and assets that are not applied.
+ */
+struct VIEWPORTMANAGER_API FVMPaneResolution
+{
+	/**
+	 * Fills OutScales with one scale per pane. PixelBudget panes share PixelBudgetMegapixels
+	 * between them at ViewportSize; UI-only panes always report 1.
+	 */
+	static void ComputeScales(TConstArrayView<FVMSplitPane> Panes, const FIntPoint& ViewportSize, float PixelBudgetMegapixels, TArray<float>& OutScales);
+
+	/** Convenience overload that reads the pixel budget from the plugin settings. */
+	static void ComputeScales(TConstArrayView<FVMSplitPane> Panes, const FIntPoint& ViewportSize, TArray<float>& OutScales);
+};
@@ -0,0 +1,60 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Pawn.h"
+#include "VMPawnPool.generated.h"
+
+/** Cumulative reuse counters for the pane pawn pool. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMPawnPoolStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Reuses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Misses = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Parked = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 Evicted = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Stats")
+	int32 IdlePawns = 0;
+};
+
+/**
+ * Unpossessed pane pawns parked per class so switching camera modes can hand an
+ * existing pawn back instead of destroying and spawning actors. Parked pawns stay
+ * in their world (which owns them) hidden, without collision and without ticking.
+ */
+struct VIEWPORTMANAGER_API FVMPawnPool
+{
+	/** Returns a parked pawn of exactly PawnClass in World, moved to SpawnTransform and reactivated, or nullptr on a miss. */
+	APawn* Acquire(TSubclassOf<APawn> PawnClass, UWorld* World, const FTransform& SpawnTransform);
+
+	/**
+	 * Parks an unpossessed Pawn while its class has fewer than MaxIdlePerClass parked pawns.
+	 * Returns false when the pool is full; the caller still owns the pawn and should destroy it.
+	 */
+	bool Park(APawn* Pawn, int32 MaxIdlePerClass);
+
+	void NoteMiss() { ++Stats.Misses; }
+
+	FVMPawnPoolStats GetStats() const;
+
+	void GetIdlePawns(TArray<APawn*>& OutPawns) const;
+
+private:
+	static void SetPawnParked(APawn* Pawn, bool bParked);
+
+	// Weak because the level owns the actors; a world teardown simply expires them
+	TMap<TWeakObjectPtr<UClass>, TArray<TWeakObjectPtr<APawn>>> Buckets;
+
+	FVMPawnPoolStats Stats;
+};
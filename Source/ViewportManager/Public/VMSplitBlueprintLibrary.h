@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "VMSplitLayoutAsset.h"
+#include "VMSplitSubsystem.h"
 #include "VMSplitBlueprintLibrary.generated.h"
 
 /**
@@ -50,6 +51,38 @@ public:
 			ToolTip = "Quick setup for 4-player grid split screen (2x2 layout)."))
 	static bool ApplySimple4PlayerLayout(TSubclassOf<UUserWidget> HUDClass = nullptr);
 
+	/**
+	 * Move or resize several panes at once
+	 * @param Edits - New rect per LocalPlayerIndex
+	 * @param OutError - Why the batch was rejected
+	 * @return True if every edit was valid and the layout was updated
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ViewportManager|Layout",
+		meta = (DisplayName = "Set Pane Rects",
+			Keywords = "pane rect batch move resize",
+			ToolTip = "Validates all edits, then applies them with a single relayout. No pane changes if any edit is invalid."))
+	static bool SetPaneRects(const TArray<FVMPaneRectEdit>& Edits, FString& OutError);
+
+	/**
+	 * Start grouping pane edits so they are applied together
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ViewportManager|Layout",
+		meta = (DisplayName = "Begin Layout Edit",
+			Keywords = "pane layout edit batch begin",
+			ToolTip = "Pane edits made until Commit Layout Edit are applied together with one relayout."))
+	static void BeginLayoutEdit();
+
+	/**
+	 * Apply every pane edit made since Begin Layout Edit
+	 * @param OutError - Why the edit was rolled back
+	 * @return True if the edited layout was valid and applied
+	 */
+	UFUNCTION(BlueprintCallable, Category = "ViewportManager|Layout",
+		meta = (DisplayName = "Commit Layout Edit",
+			Keywords = "pane layout edit batch commit apply",
+			ToolTip = "Validates the edited layout and applies it. An invalid layout is restored to its state at Begin Layout Edit."))
+	static bool CommitLayoutEdit(FString& OutError);
+
 	/**
 	 * Get the ViewportManager subsystem
 	 * @return The VM split subsystem, or nullptr if not available
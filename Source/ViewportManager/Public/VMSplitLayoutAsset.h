@@ -8,6 +8,8 @@
 #include "Blueprint/UserWidget.h"
 #include "VMSplitLayoutAsset.generated.h"
 
+class UVMPaneRenderProfile;
+
 UENUM(BlueprintType)
 enum class EVMViewportCameraMode : uint8
 {
@@ -16,6 +18,40 @@ enum class EVMViewportCameraMode : uint8
 	Custom	UMETA(DisplayName = "Custom Pawn")
 };
 
+UENUM(BlueprintType)
+enum class EVMPaneClassLoadPolicy : uint8
+{
+	Eager				UMETA(DisplayName = "Eager", ToolTip = "Streamed together with the layout before it is applied"),
+	OnApply				UMETA(DisplayName = "On Apply", ToolTip = "Loaded when the pane is applied; not prefetched with the layout"),
+	OnFirstVisibility	UMETA(DisplayName = "On First Visibility", ToolTip = "Streamed in the background when the pane is first shown; a placeholder is drawn until it is ready")
+};
+
+UENUM(BlueprintType)
+enum class EVMPaneResolutionPolicy : uint8
+{
+	Native				UMETA(DisplayName = "Native", ToolTip = "Render at full resolution"),
+	FixedScale			UMETA(DisplayName = "Fixed Scale", ToolTip = "Render at ResolutionScale"),
+	AreaProportional	UMETA(DisplayName = "Area Proportional", ToolTip = "Scale pixel count with pane area relative to the largest pane"),
+	PixelBudget			UMETA(DisplayName = "Pixel Budget", ToolTip = "Share the global pane pixel budget with the other budgeted panes")
+};
+
+UENUM(BlueprintType)
+enum class EVMInputRoutingPolicy : uint8
+{
+	Hover		UMETA(DisplayName = "Hover", ToolTip = "The pane under the mouse cursor"),
+	FocusedPane	UMETA(DisplayName = "Focused Pane", ToolTip = "The focused pane, whatever the cursor is over"),
+	Fixed		UMETA(DisplayName = "Fixed", ToolTip = "Always the same pane"),
+	Broadcast	UMETA(DisplayName = "Broadcast", ToolTip = "Every pane that receives keyboard and mouse input")
+};
+
+UENUM(BlueprintType)
+enum class EVMInputDeviceType : uint8
+{
+	Keyboard,
+	Mouse,
+	Gamepad
+};
+
 USTRUCT(BlueprintType)
 struct VIEWPORTMANAGER_API FVMCameraControlSettings
 {
@@ -105,20 +141,57 @@ struct VIEWPORTMANAGER_API FVMSplitPane
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (ToolTip = "UI-only pane renders only the HUD widget without a 3D viewport. Use for overlay UI on top of other viewports."))
 	bool bUIOnly = false;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "!bUIOnly", ToolTip = "View-only pane renders a passive camera view without a local player, controller or pawn. Use for camera walls."))
+	bool bViewOnly = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "bViewOnly", ToolTip = "Actor the view follows and looks at; uses CameraTransform or FocusPoint when unset"))
+	TSoftObjectPtr<AActor> ViewTarget;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "bViewOnly", ClampMin = "5.0", ClampMax = "170.0", Units = "deg"))
+	float ViewFieldOfView = 90.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "!bUIOnly && !bViewOnly", ToolTip = "Mirror pane shows another pane's rendered image scaled into this rect, with no scene render, local player or pawn of its own. Can still carry a HUD."))
+	bool bMirror = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "bMirror", ToolTip = "LocalPlayerIndex of the player or view-only pane to mirror"))
+	int32 MirrorSourcePlayerIndex = 0;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "!bUIOnly"))
+	TSoftClassPtr<APawn> SoftPawnClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (ToolTip = "Optional HUD widget class to display overlay UI for this viewport"))
+	TSoftClassPtr<UUserWidget> SoftViewportHUDClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (ToolTip = "When the pawn and HUD classes of this pane are loaded"))
+	EVMPaneClassLoadPolicy ClassLoadPolicy = EVMPaneClassLoadPolicy::Eager;
+
+	/** Legacy hard reference; loads the class with the layout. Prefer SoftPawnClass, which takes precedence when set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane|Legacy", meta = (EditCondition = "!bUIOnly"))
 	TSubclassOf<APawn> PawnClass;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (AllowedClasses = "/Script/UMGEditor.WidgetBlueprint, /Script/UMG.UserWidget", ToolTip = "Optional HUD widget class to display overlay UI for this viewport"))
+	/** Legacy hard reference; loads the class with the layout. Prefer SoftViewportHUDClass, which takes precedence when set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane|Legacy", meta = (AllowedClasses = "/Script/UMGEditor.WidgetBlueprint, /Script/UMG.UserWidget"))
 	TSubclassOf<UUserWidget> ViewportHUDClass;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane")
 	bool bReceivesKeyboardMouse = true;
 
+	/** Receives keyboard and mouse input when the layout routes them Fixed. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "!bUIOnly && !bViewOnly && !bMirror"))
+	bool bFixedKeyboardMouseTarget = false;
+
+	/** Gamepad always routed to this pane's player; -1 leaves gamepads to the engine's controller id routing. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pane", meta = (EditCondition = "!bUIOnly && !bViewOnly && !bMirror", ClampMin = "-1"))
+	int32 GamepadIndex = INDEX_NONE;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (EditCondition = "!bUIOnly"))
 	EVMViewportCameraMode CameraMode = EVMViewportCameraMode::Orbit;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (EditCondition = "CameraMode == EVMViewportCameraMode::Custom"))
+	TSoftClassPtr<APawn> SoftCustomPawnClass;
+
+	/** Legacy hard reference; prefer SoftCustomPawnClass, which takes precedence when set. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera|Legacy", meta = (EditCondition = "CameraMode == EVMViewportCameraMode::Custom"))
 	TSubclassOf<APawn> CustomPawnClass = nullptr;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera", meta = (EditCondition = "bUseCustomCameraTransform"))
@@ -138,6 +211,38 @@ struct VIEWPORTMANAGER_API FVMSplitPane
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Camera Controls", meta = (EditCondition = "!bUIOnly"))
 	FVMCameraControlSettings CameraControls;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering", meta = (EditCondition = "!bUIOnly"))
+	EVMPaneResolutionPolicy ResolutionPolicy = EVMPaneResolutionPolicy::Native;
+
+	/** Per-axis resolution scale used by the Fixed Scale policy. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering", meta = (EditCondition = "ResolutionPolicy == EVMPaneResolutionPolicy::FixedScale", ClampMin = "0.1", ClampMax = "1.0"))
+	float ResolutionScale = 1.0f;
+
+	/** Lower bound for the computed scale of non-native policies. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering", meta = (EditCondition = "ResolutionPolicy != EVMPaneResolutionPolicy::Native", ClampMin = "0.1", ClampMax = "1.0"))
+	float MinResolutionScale = 0.25f;
+
+	/** Show flag, LOD and post-process overrides for this pane's view. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering", meta = (EditCondition = "!bUIOnly"))
+	TObjectPtr<UVMPaneRenderProfile> RenderProfile;
+
+	/**
+	 * Update this pane every Nth frame. View-only panes keep their last image in between; player panes
+	 * throttle their pawn, controller and HUD ticks instead. The focused pane always updates every frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering", meta = (EditCondition = "!bUIOnly", ClampMin = "1", ClampMax = "16"))
+	int32 UpdateDivisor = 1;
+
+	// Class references with the soft field taking precedence over the legacy hard one; never loads anything
+	TSoftClassPtr<APawn> GetPawnClassRef() const { return !SoftPawnClass.IsNull() ? SoftPawnClass : TSoftClassPtr<APawn>(PawnClass.Get()); }
+	TSoftClassPtr<APawn> GetCustomPawnClassRef() const { return !SoftCustomPawnClass.IsNull() ? SoftCustomPawnClass : TSoftClassPtr<APawn>(CustomPawnClass.Get()); }
+	TSoftClassPtr<UUserWidget> GetViewportHUDClassRef() const { return !SoftViewportHUDClass.IsNull() ? SoftViewportHUDClass : TSoftClassPtr<UUserWidget>(ViewportHUDClass.Get()); }
+
+	/** UI-only and view-only panes have no local player, controller or pawn. */
+	bool NeedsLocalPlayer() const { return !bUIOnly && !bViewOnly && !bMirror; }
+
+	bool HasLegacyClassReferences() const { return PawnClass || CustomPawnClass || ViewportHUDClass; }
 };
 
 UCLASS(BlueprintType, Blueprintable)
@@ -152,9 +257,20 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout")
 	bool bAutoSpawnPlayers = true;
 
+	/** Fixed sends keyboard input to the pane marked bFixedKeyboardMouseTarget. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	EVMInputRoutingPolicy KeyboardRouting = EVMInputRoutingPolicy::Hover;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+	EVMInputRoutingPolicy MouseRouting = EVMInputRoutingPolicy::Hover;
+
 	UFUNCTION(CallInEditor, Category = "Layout")
 	void ValidateLayout();
 
+	/** Moves every legacy hard class reference into its soft counterpart so loading the layout no longer loads pane classes. */
+	UFUNCTION(CallInEditor, Category = "Layout")
+	void MigrateToSoftClassReferences();
+
 protected:
 #if WITH_EDITOR
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
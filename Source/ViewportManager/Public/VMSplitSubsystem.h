@@ -4,9 +4,38 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
 #include "VMSplitLayoutAsset.h"
 #include "VMSplitSubsystem.generated.h"
 
+class UCurveFloat;
+
+/** How long one asset took to become resident during an async layout load. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMDependencyLoadTiming
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Loading")
+	FSoftObjectPath AssetPath;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Viewport Manager|Loading")
+	float LoadSeconds = 0.0f;
+};
+
+/** One pane move/resize in a batched layout edit. */
+USTRUCT(BlueprintType)
+struct VIEWPORTMANAGER_API FVMPaneRectEdit
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport Manager")
+	int32 LocalPlayerIndex = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Viewport Manager")
+	FVMSplitRect Rect;
+};
+
 UCLASS(BlueprintType)
 class VIEWPORTMANAGER_API UVMSplitSubsystem : public UGameInstanceSubsystem
 {
@@ -19,9 +48,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
 	void ApplyLayout(UVMSplitLayoutAsset* Layout);
 
+	/** Applies Layout and animates the panes from their current placement over Duration seconds. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	void TransitionToLayout(UVMSplitLayoutAsset* Layout, float Duration = 0.3f, UCurveFloat* Curve = nullptr);
+
+	/** Streams the layout and every pane class it references, then applies it once all are resident. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	void ApplyLayoutAsync(TSoftObjectPtr<UVMSplitLayoutAsset> Layout);
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager", BlueprintPure)
+	bool IsLayoutLoadPending() const { return PendingLayoutLoadHandles.Num() > 0; }
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager|Loading", BlueprintPure)
+	TArray<FVMDependencyLoadTiming> GetLastLayoutLoadTimings() const { return LastLayoutLoadTimings; }
+
 	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
 	void SetPaneRect(int32 LocalPlayerIndex, float OriginX, float OriginY, float SizeX, float SizeY);
 
+	/** Validates every edit, then moves all panes with a single relayout. Nothing changes when any edit is invalid. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	bool SetPaneRects(const TArray<FVMPaneRectEdit>& Edits, FString& OutError);
+
+	/** Defers the relayout of SetPaneRect, SetPaneRects and SetPanePawnClass until the matching CommitLayoutEdit. Edits nest. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	void BeginLayoutEdit();
+
+	/** Validates the edited layout and applies it with one relayout; an invalid layout is rolled back to its state at BeginLayoutEdit. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	bool CommitLayoutEdit(FString& OutError);
+
+	/** Discards every change made since the outermost BeginLayoutEdit. */
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
+	void CancelLayoutEdit();
+
+	UFUNCTION(BlueprintCallable, Category = "Viewport Manager", BlueprintPure)
+	bool IsLayoutEditOpen() const { return LayoutEditDepth > 0; }
+
 	UFUNCTION(BlueprintCallable, Category = "Viewport Manager")
 	bool GetPaneRect(int32 LocalPlayerIndex, FVector2f& OutOrigin01, FVector2f& OutSize01);
 
@@ -52,6 +114,42 @@ protected:
 	void OnWorldInitialized(UWorld* World, const UWorld::InitializationValues IVS);
 
 	void LoadDefaultLayout();
+
+	/** Applies CurrentLayout now, or marks it for the commit when a layout edit is open. */
+	void ApplyCurrentLayoutOrDefer();
+	void EndLayoutEdit();
+	static bool ValidatePaneRect(const FVMSplitRect& Rect, FString& OutError);
+
+	void OnAsyncLayoutLoaded(int32 RequestId, FSoftObjectPath LayoutPath, double RequestTime);
+	void OnAsyncDependencyLoaded(int32 RequestId, FSoftObjectPath DependencyPath, double RequestTime);
+	void FinishAsyncLayoutLoad(int32 RequestId);
+	void CancelAsyncLayoutLoad();
+	static void ReleaseLoadHandles(TArray<TSharedPtr<FStreamableHandle>>& Handles);
+
+	FStreamableManager StreamableManager;
+
+	// Handles keep the layout and its dependencies resident while it streams in
+	TArray<TSharedPtr<FStreamableHandle>> PendingLayoutLoadHandles;
+
+	// The same handles once applied, kept until a different layout is applied so staged and deferred applies can still resolve them
+	TArray<TSharedPtr<FStreamableHandle>> AppliedLayoutHandles;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UVMSplitLayoutAsset> PendingAsyncLayout;
+
+	TArray<FVMDependencyLoadTiming> LastLayoutLoadTimings;
+
+	// Pane state of LayoutEditTarget at the outermost BeginLayoutEdit, restored on cancel or failed validation
+	TArray<FVMSplitPane> LayoutEditSnapshot;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UVMSplitLayoutAsset> LayoutEditTarget;
+
+	int32 LayoutEditDepth = 0;
+	bool bLayoutEditDirty = false;
+
+	int32 AsyncLayoutRequestId = 0;
+	int32 OutstandingDependencyLoads = 0;
 };
 
 
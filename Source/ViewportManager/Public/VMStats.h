@@ -0,0 +1,47 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+/** "stat ViewportManager" */
+DECLARE_STATS_GROUP(TEXT("ViewportManager"), STATGROUP_ViewportManager, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Apply Layout"), STAT_VM_ApplyLayout, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Layout Players"), STAT_VM_LayoutPlayers, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn And Possess Pawns"), STAT_VM_SpawnAndPossessPawns, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Setup Viewport HUDs"), STAT_VM_SetupViewportHUDs, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Input Key"), STAT_VM_InputKey, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Input Axis"), STAT_VM_InputAxis, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Pawn Tick"), STAT_VM_CameraPawnTick, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Camera Update Subsystem"), STAT_VM_CameraUpdateSubsystem, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+
+// Per-frame counts, cleared every frame
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Input Events In"), STAT_VM_InputEventsIn, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Input Events Routed"), STAT_VM_InputEventsRouted, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+
+// Current totals, set by the viewport client every frame
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Panes"), STAT_VM_Panes, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dormant Panes"), STAT_VM_DormantPanes, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live HUDs"), STAT_VM_LiveHUDs, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pane Pawns"), STAT_VM_PanePawns, STATGROUP_ViewportManager, VIEWPORTMANAGER_API);
+
+/** "-trace=cpu,ViewportManager" records the plugin's scopes in Unreal Insights without enabling stats. */
+UE_TRACE_CHANNEL_EXTERN(ViewportManagerChannel, VIEWPORTMANAGER_API);
+
+/** Cycle stat plus an Insights scope on ViewportManagerChannel named after the stat. */
+#define VM_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(#Stat, ViewportManagerChannel)
+
+/** "-llm" then "stat LLMFULL" or the Insights memory view; allocations roll up under ViewportManager. */
+LLM_DECLARE_TAG_API(ViewportManager, VIEWPORTMANAGER_API);
+LLM_DECLARE_TAG_API(ViewportManager_Layout, VIEWPORTMANAGER_API);
+LLM_DECLARE_TAG_API(ViewportManager_HUD, VIEWPORTMANAGER_API);
+LLM_DECLARE_TAG_API(ViewportManager_Pawns, VIEWPORTMANAGER_API);
+LLM_DECLARE_TAG_API(ViewportManager_Designer, VIEWPORTMANAGER_API);
+LLM_DECLARE_TAG_API(ViewportManager_Undo, VIEWPORTMANAGER_API);
@@ -0,0 +1,74 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VMViewPanes.generated.h"
+
+class ASceneCapture2D;
+class UCanvas;
+class UTextureRenderTarget2D;
+class UVMSplitLayoutAsset;
+struct FVMSplitPane;
+
+USTRUCT()
+struct FVMViewPaneInstance
+{
+	GENERATED_BODY()
+
+	int32 PaneIndex = INDEX_NONE;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UTextureRenderTarget2D> RenderTarget;
+
+	TWeakObjectPtr<ASceneCapture2D> Capture;
+
+	TWeakObjectPtr<AActor> Target;
+
+	float ResolutionScale = 1.0f;
+};
+
+/**
+ * Camera-only panes of a layout. Each one is a transient scene capture rendering into a
+ * render target that the viewport client draws into the pane rect, so a passive view needs
+ * no local player, controller, pawn or input component. Captures never tick; the viewport
+ * client moves the ones that follow a target actor from a single loop.
+ *
+ * GameViewportClient::Draw renders every pane in one shared view family, but it only adds views
+ * through ULocalPlayer::CalcSceneView, one per local player. There is no hook to add a view
+ * without a local player, so a passive camera would otherwise cost a full player.
+ */
+USTRUCT()
+struct VIEWPORTMANAGER_API FVMViewPaneSet
+{
+	GENERATED_BODY()
+
+	/** Matches the set to the layout's view panes, reusing existing captures where possible. ResolutionScales holds one entry per pane. */
+	void Rebuild(const UVMSplitLayoutAsset& Layout, UWorld* World, const FIntPoint& ViewportSize, TConstArrayView<float> ResolutionScales);
+
+	/** Resizes the render targets for new pane rects or resolution scales, keeping every capture as it is. */
+	void UpdateResolution(const UVMSplitLayoutAsset& Layout, const FIntPoint& ViewportSize, TConstArrayView<float> ResolutionScales);
+
+	/** Destroys every capture. */
+	void Reset();
+
+	/** Moves captures that follow a target actor and captures the panes in PanesDue; the others keep their last image. */
+	void UpdateCameras(const UVMSplitLayoutAsset& Layout, const TBitArray<>& PanesDue);
+
+	/** Draws each view into its pane rect, resizing render targets when the canvas size changed. */
+	void Draw(UCanvas* Canvas, const UVMSplitLayoutAsset& Layout);
+
+	int32 Num() const { return Instances.Num(); }
+
+	/** Render target of the view pane at PaneIndex, or nullptr. */
+	UTextureRenderTarget2D* FindRenderTarget(int32 PaneIndex) const;
+
+	static FTransform ComputeViewTransform(const FVMSplitPane& Pane, const AActor* Target);
+
+private:
+	static FIntPoint GetRenderTargetSize(const FVMSplitPane& Pane, const FIntPoint& ViewportSize, float ResolutionScale);
+	static void ResizeRenderTarget(FVMViewPaneInstance& Instance, const FVMSplitPane& Pane, const FIntPoint& ViewportSize);
+
+	UPROPERTY(Transient)
+	TArray<FVMViewPaneInstance> Instances;
+};
@@ -24,6 +24,12 @@ public:
 
 	virtual void NativeConstruct() override;
 	virtual void NativeOnInitialized() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+	virtual int32 NativePaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+		FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+	/** Ticks the widget (Blueprint Tick, animations, latent actions) every Nth frame with the accumulated delta time. */
+	void SetUpdateDivisor(int32 InUpdateDivisor);
 
 	UFUNCTION(BlueprintCallable, Category = "VM Viewport HUD")
 	void SetViewportInfo(int32 InLocalPlayerIndex, const FVMSplitRect& InViewportRect);
@@ -49,6 +55,11 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, Category = "VM Viewport HUD")
 	FVMSplitRect ViewportRect;
+
+private:
+	int32 UpdateDivisor = 1;
+	int32 FramesSinceUpdate = 0;
+	float PendingDeltaTime = 0.0f;
 };
 
 
@@ -27,4 +27,27 @@ public:
 
 	UPROPERTY(EditAnywhere, Config, Category = "Layouts")
 	bool bAutoAddMissingLocalPlayers;
+
+	/** Spread full layout applies across frames so large layouts don't hitch. Panes show a placeholder until ready. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bUseStagedLayoutApply;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (EditCondition = "bUseStagedLayoutApply", ClampMin = "0.1", Units = "ms"))
+	float StagedApplyFrameBudgetMs;
+
+	/** Idle pane HUD widgets kept per widget class for reuse when layouts change. 0 disables pooling. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0", ClampMax = "64"))
+	int32 MaxPooledHUDWidgetsPerClass;
+
+	/** Unpossessed pane pawns parked per pawn class for reuse when the pane's camera mode or pawn class changes. 0 disables pooling. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0", ClampMax = "32"))
+	int32 MaxPooledPawnsPerClass;
+
+	/** Pixels shared by all panes using the Pixel Budget resolution policy. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance", meta = (ClampMin = "0.1"))
+	float PanePixelBudgetMegapixels;
+
+	/** Route the sum of each frame's mouse axis events to a pane once instead of every raw event. Helps with high polling rate mice. */
+	UPROPERTY(EditAnywhere, Config, Category = "Performance")
+	bool bCoalesceMouseAxisInput;
 };
@@ -36,6 +36,8 @@ public class ViewportManager : ModuleRules
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
+				"RenderCore",
+				"RHI"
 			}
 		);
 		
@@ -24,6 +24,7 @@
 #include "Framework/Commands/UICommandList.h"
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "VMStats.h"
 
 static FLinearColor GetPaneColor(int32 LocalPlayerIndex, bool bSelected)
 {
@@ -42,6 +43,8 @@ SVMLayoutDesignerWidget::~SVMLayoutDesignerWidget()
 
 void SVMLayoutDesignerWidget::Construct(const FArguments& InArgs)
 {
+	LLM_SCOPE_BYTAG(ViewportManager_Designer);
+
 	bAllowAssetPicker = InArgs._bShowAssetPicker;
 
 	FPropertyEditorModule& PropertyModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
@@ -406,6 +409,28 @@ void SVMLayoutDesignerWidget::RefreshPreview()
 				FText::AsNumber(FMath::RoundToInt(Rect.Size01.Y * 100.f))
 			);
 		}
+		else if (Pane.bViewOnly)
+		{
+			Label = FText::Format(
+				NSLOCTEXT("VMLayoutDesigner", "ViewOnlyPaneFmt", "[View {0}]\n({1}, {2})\n{3} x {4}"),
+				FText::AsNumber(Pane.LocalPlayerIndex),
+				FText::AsNumber(FMath::RoundToInt(Rect.Origin01.X * 100.f)),
+				FText::AsNumber(FMath::RoundToInt(Rect.Origin01.Y * 100.f)),
+				FText::AsNumber(FMath::RoundToInt(Rect.Size01.X * 100.f)),
+				FText::AsNumber(FMath::RoundToInt(Rect.Size01.Y * 100.f))
+			);
+		}
+		else if (Pane.bMirror)
+		{
+			Label = FText::Format(
+				NSLOCTEXT("VMLayoutDesigner", "MirrorPaneFmt", "[Mirror of {0}]\n({1}, {2})\n{3} x {4}"),
+				FText::AsNumber(Pane.MirrorSourcePlayerIndex),
+				FText::AsNumber(FMath::RoundToInt(Rect.Origin01.X * 100.f)),
+				FText::AsNumber(FMath::RoundToInt(Rect.Origin01.Y * 100.f)),
+				FText::AsNumber(FMath::RoundToInt(Rect.Size01.X * 100.f)),
+				FText::AsNumber(FMath::RoundToInt(Rect.Size01.Y * 100.f))
+			);
+		}
 		else
 		{
 			Label = FText::Format(
@@ -31,7 +31,7 @@ void UVMInputSetupWidget::CreateInputAssets()
 		if (Package)
 		{
 			// Asset already exists, skip
-			UE_LOG(LogViewportManager, Warning, TEXT("InputAction already exists: %s"), *AssetName);
+			UE_LOG(LogVMEditor, Warning, TEXT("InputAction already exists: %s"), *AssetName);
 			return nullptr;
 		}
 
@@ -63,7 +63,7 @@ void UVMInputSetupWidget::CreateInputAssets()
 		if (UPackage::SavePackage(Package, InputAction, *PackageFileName, SaveArgs))
 		{
 			CreatedAssets.Add(AssetName);
-			UE_LOG(LogViewportManager, Log, TEXT("Created InputAction: %s"), *AssetName);
+			UE_LOG(LogVMEditor, Log, TEXT("Created InputAction: %s"), *AssetName);
 			return InputAction;
 		}
 		else
@@ -74,7 +74,7 @@ void UVMInputSetupWidget::CreateInputAssets()
 	};
 
 	// Create InputAction assets
-	UE_LOG(LogViewportManager, Log, TEXT("=== Starting Enhanced Input Setup ==="));
+	UE_LOG(LogVMEditor, Log, TEXT("=== Starting Enhanced Input Setup ==="));
 
 	UInputAction* IA_Look = CreateInputAction(TEXT("IA_Look"), EInputActionValueType::Axis2D);
 	UInputAction* IA_Zoom = CreateInputAction(TEXT("IA_Zoom"), EInputActionValueType::Axis1D);
@@ -97,7 +97,7 @@ void UVMInputSetupWidget::CreateInputAssets()
 	{
 		// Use existing IMC
 		IMC = Cast<UInputMappingContext>(IMCAsset.GetAsset());
-		UE_LOG(LogViewportManager, Log, TEXT("Found existing IMC_ViewportCamera"));
+		UE_LOG(LogVMEditor, Log, TEXT("Found existing IMC_ViewportCamera"));
 	}
 	else
 	{
@@ -121,7 +121,7 @@ void UVMInputSetupWidget::CreateInputAssets()
 				if (UPackage::SavePackage(IMCPackage, IMC, *IMCPackageFileName, SaveArgs))
 				{
 					CreatedAssets.Add(TEXT("IMC_ViewportCamera"));
-					UE_LOG(LogViewportManager, Log, TEXT("Created InputMappingContext: IMC_ViewportCamera"));
+					UE_LOG(LogVMEditor, Log, TEXT("Created InputMappingContext: IMC_ViewportCamera"));
 				}
 				else
 				{
@@ -239,7 +239,7 @@ void UVMInputSetupWidget::CreateInputAssets()
 	ResultMessage += TEXT("✓ Everything is ready! Camera controls will work immediately!\n");
 	ResultMessage += TEXT("Assets saved to: /ViewportManager/Input/\n");
 
-	UE_LOG(LogViewportManager, Log, TEXT("%s"), *ResultMessage);
+	UE_LOG(LogVMEditor, Log, TEXT("%s"), *ResultMessage);
 
 	FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(ResultMessage));
 
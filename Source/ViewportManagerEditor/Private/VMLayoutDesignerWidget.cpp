@@ -15,6 +15,7 @@
 #include "EditorUtilitySubsystem.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "VMLog.h"
+#include "VMStats.h"
 
 UVMLayoutDesignerWidget::UVMLayoutDesignerWidget(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -25,6 +26,8 @@ UVMLayoutDesignerWidget::UVMLayoutDesignerWidget(const FObjectInitializer& Objec
 
 void UVMLayoutDesignerWidget::NativeConstruct()
 {
+	LLM_SCOPE_BYTAG(ViewportManager_Designer);
+
 	Super::NativeConstruct();
 	
 	// Create design canvas if not bound in Blueprint
@@ -50,7 +53,7 @@ void UVMLayoutDesignerWidget::NativeConstruct()
 	// Update status
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::NativeConstruct - Layout designer initialized"));
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::NativeConstruct - Layout designer initialized"));
 }
 
 void UVMLayoutDesignerWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
@@ -68,12 +71,14 @@ void UVMLayoutDesignerWidget::SetLayoutAsset(UVMSplitLayoutAsset* InLayoutAsset)
 	RefreshLayout();
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::SetLayoutAsset - Set layout asset: %s"), 
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::SetLayoutAsset - Set layout asset: %s"), 
 		InLayoutAsset ? *InLayoutAsset->GetName() : TEXT("None"));
 }
 
 void UVMLayoutDesignerWidget::RefreshLayout()
 {
+	LLM_SCOPE_BYTAG(ViewportManager_Designer);
+
 	if (!DesignCanvas)
 		return;
 	
@@ -126,8 +131,8 @@ void UVMLayoutDesignerWidget::AddNewPane()
 	const FVector2f Origin(CellSize.X * ColumnIndex, CellSize.Y * RowIndex);
 	NewPane.Rect.Origin01 = Origin;
 	NewPane.Rect.Size01 = CellSize;
-	NewPane.ViewportHUDClass = nullptr;
-	NewPane.PawnClass = nullptr;
+	NewPane.SoftViewportHUDClass = nullptr;
+	NewPane.SoftPawnClass = nullptr;
 	NewPane.bUseCustomCameraTransform = false;
 	NewPane.bUseCustomFocusPoint = false;
 	NewPane.FocusPoint = FVector::ZeroVector;
@@ -140,7 +145,7 @@ void UVMLayoutDesignerWidget::AddNewPane()
 	RefreshLayout();
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::AddNewPane - Added new pane for LocalPlayer %d"), NewIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::AddNewPane - Added new pane for LocalPlayer %d"), NewIndex);
 }
 
 void UVMLayoutDesignerWidget::RemoveSelectedPane()
@@ -155,7 +160,7 @@ void UVMLayoutDesignerWidget::RemoveSelectedPane()
 	RefreshLayout();
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::RemoveSelectedPane - Removed pane at index %d"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::RemoveSelectedPane - Removed pane at index %d"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::ApplyTwoPlayerHorizontal()
@@ -183,7 +188,7 @@ void UVMLayoutDesignerWidget::ApplyTwoPlayerHorizontal()
 	RefreshLayout();
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::ApplyTwoPlayerHorizontal - Applied horizontal split layout"));
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::ApplyTwoPlayerHorizontal - Applied horizontal split layout"));
 }
 
 void UVMLayoutDesignerWidget::ApplyTwoPlayerVertical()
@@ -211,7 +216,7 @@ void UVMLayoutDesignerWidget::ApplyTwoPlayerVertical()
 	RefreshLayout();
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::ApplyTwoPlayerVertical - Applied vertical split layout"));
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::ApplyTwoPlayerVertical - Applied vertical split layout"));
 }
 
 void UVMLayoutDesignerWidget::ApplyFourPlayerGrid()
@@ -253,7 +258,7 @@ void UVMLayoutDesignerWidget::ApplyFourPlayerGrid()
 	RefreshLayout();
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::ApplyFourPlayerGrid - Applied 2x2 grid layout"));
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::ApplyFourPlayerGrid - Applied 2x2 grid layout"));
 }
 
 void UVMLayoutDesignerWidget::CreatePaneVisuals()
@@ -295,9 +300,9 @@ UBorder* UVMLayoutDesignerWidget::CreatePaneVisual(int32 PaneIndex, const FVMSpl
 		Pane.Rect.Origin01.X, Pane.Rect.Origin01.Y,
 		Pane.Rect.Size01.X, Pane.Rect.Size01.Y);
 	
-	if (Pane.ViewportHUDClass)
+	if (!Pane.GetViewportHUDClassRef().IsNull())
 	{
-		LabelText += FString::Printf(TEXT("\nHUD: %s"), *Pane.ViewportHUDClass->GetName());
+		LabelText += FString::Printf(TEXT("\nHUD: %s"), *Pane.GetViewportHUDClassRef().GetAssetName());
 	}
 	
 	PaneLabel->SetText(FText::FromString(LabelText));
@@ -386,9 +391,9 @@ void UVMLayoutDesignerWidget::UpdatePaneVisual(int32 PaneIndex)
 			Pane.Rect.Origin01.X, Pane.Rect.Origin01.Y,
 			Pane.Rect.Size01.X, Pane.Rect.Size01.Y);
 		
-		if (Pane.ViewportHUDClass)
+		if (!Pane.GetViewportHUDClassRef().IsNull())
 		{
-			LabelText += FString::Printf(TEXT("\nHUD: %s"), *Pane.ViewportHUDClass->GetName());
+			LabelText += FString::Printf(TEXT("\nHUD: %s"), *Pane.GetViewportHUDClassRef().GetAssetName());
 		}
 		
 		Label->SetText(FText::FromString(LabelText));
@@ -407,7 +412,7 @@ void UVMLayoutDesignerWidget::OnPaneClicked(int32 PaneIndex)
 	
 	UpdateStatusText();
 	
-	UE_LOG(LogViewportManager, Log, TEXT("UVMLayoutDesignerWidget::OnPaneClicked - Selected pane %d"), PaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("UVMLayoutDesignerWidget::OnPaneClicked - Selected pane %d"), PaneIndex);
 }
 
 void UVMLayoutDesignerWidget::UpdateStatusText()
@@ -491,13 +496,13 @@ void UVMLayoutDesignerWidget::ToggleSnapToGrid()
 {
 	bSnapToGrid = !bSnapToGrid;
 	UpdateStatusText();
-	UE_LOG(LogViewportManager, Log, TEXT("Snap to grid: %s"), bSnapToGrid ? TEXT("Enabled") : TEXT("Disabled"));
+	UE_LOG(LogVMEditor, Log, TEXT("Snap to grid: %s"), bSnapToGrid ? TEXT("Enabled") : TEXT("Disabled"));
 }
 
 void UVMLayoutDesignerWidget::SetGridSize(float NewGridSize)
 {
 	GridSize = FMath::Clamp(NewGridSize, 0.01f, 0.5f);
-	UE_LOG(LogViewportManager, Log, TEXT("Grid size set to: %.3f"), GridSize);
+	UE_LOG(LogVMEditor, Log, TEXT("Grid size set to: %.3f"), GridSize);
 }
 
 // ==================== Alignment Tools Implementation ====================
@@ -511,7 +516,7 @@ void UVMLayoutDesignerWidget::AlignSelectedPaneLeft()
 	CurrentLayoutAsset->Panes[SelectedPaneIndex].Rect.Origin01.X = 0.0f;
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Aligned pane %d to left"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("Aligned pane %d to left"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::AlignSelectedPaneRight()
@@ -524,7 +529,7 @@ void UVMLayoutDesignerWidget::AlignSelectedPaneRight()
 	Pane.Rect.Origin01.X = 1.0f - Pane.Rect.Size01.X;
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Aligned pane %d to right"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("Aligned pane %d to right"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::AlignSelectedPaneTop()
@@ -536,7 +541,7 @@ void UVMLayoutDesignerWidget::AlignSelectedPaneTop()
 	CurrentLayoutAsset->Panes[SelectedPaneIndex].Rect.Origin01.Y = 0.0f;
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Aligned pane %d to top"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("Aligned pane %d to top"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::AlignSelectedPaneBottom()
@@ -549,7 +554,7 @@ void UVMLayoutDesignerWidget::AlignSelectedPaneBottom()
 	Pane.Rect.Origin01.Y = 1.0f - Pane.Rect.Size01.Y;
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Aligned pane %d to bottom"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("Aligned pane %d to bottom"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::AlignSelectedPaneCenter()
@@ -562,7 +567,7 @@ void UVMLayoutDesignerWidget::AlignSelectedPaneCenter()
 	Pane.Rect.Origin01.X = (1.0f - Pane.Rect.Size01.X) * 0.5f;
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Aligned pane %d to center"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("Aligned pane %d to center"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::AlignSelectedPaneMiddle()
@@ -575,7 +580,7 @@ void UVMLayoutDesignerWidget::AlignSelectedPaneMiddle()
 	Pane.Rect.Origin01.Y = (1.0f - Pane.Rect.Size01.Y) * 0.5f;
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Aligned pane %d to middle"), SelectedPaneIndex);
+	UE_LOG(LogVMEditor, Log, TEXT("Aligned pane %d to middle"), SelectedPaneIndex);
 }
 
 void UVMLayoutDesignerWidget::DistributePanesHorizontally()
@@ -616,7 +621,7 @@ void UVMLayoutDesignerWidget::DistributePanesHorizontally()
 
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Distributed %d panes horizontally"), PaneIndices.Num());
+	UE_LOG(LogVMEditor, Log, TEXT("Distributed %d panes horizontally"), PaneIndices.Num());
 }
 
 void UVMLayoutDesignerWidget::DistributePanesVertically()
@@ -657,13 +662,15 @@ void UVMLayoutDesignerWidget::DistributePanesVertically()
 
 	CurrentLayoutAsset->MarkPackageDirty();
 	RefreshLayout();
-	UE_LOG(LogViewportManager, Log, TEXT("Distributed %d panes vertically"), PaneIndices.Num());
+	UE_LOG(LogVMEditor, Log, TEXT("Distributed %d panes vertically"), PaneIndices.Num());
 }
 
 // ==================== Undo/Redo Implementation ====================
 
 void UVMLayoutDesignerWidget::PushUndoState()
 {
+	LLM_SCOPE_BYTAG(ViewportManager_Undo);
+
 	if (!CurrentLayoutAsset)
 		return;
 
@@ -682,12 +689,14 @@ void UVMLayoutDesignerWidget::PushUndoState()
 		// Clear redo stack when a new action is performed
 		RedoStack.Empty();
 
-		UE_LOG(LogViewportManager, Verbose, TEXT("Pushed undo state (stack size: %d)"), UndoStack.Num());
+		UE_LOG(LogVMEditor, Verbose, TEXT("Pushed undo state (stack size: %d)"), UndoStack.Num());
 	}
 }
 
 void UVMLayoutDesignerWidget::Undo()
 {
+	LLM_SCOPE_BYTAG(ViewportManager_Undo);
+
 	if (!CanUndo())
 		return;
 
@@ -708,13 +717,15 @@ void UVMLayoutDesignerWidget::Undo()
 		RefreshLayout();
 		UpdateStatusText();
 
-		UE_LOG(LogViewportManager, Log, TEXT("Undo performed (undo stack: %d, redo stack: %d)"),
+		UE_LOG(LogVMEditor, Log, TEXT("Undo performed (undo stack: %d, redo stack: %d)"),
 			UndoStack.Num(), RedoStack.Num());
 	}
 }
 
 void UVMLayoutDesignerWidget::Redo()
 {
+	LLM_SCOPE_BYTAG(ViewportManager_Undo);
+
 	if (!CanRedo())
 		return;
 
@@ -735,7 +746,7 @@ void UVMLayoutDesignerWidget::Redo()
 		RefreshLayout();
 		UpdateStatusText();
 
-		UE_LOG(LogViewportManager, Log, TEXT("Redo performed (undo stack: %d, redo stack: %d)"),
+		UE_LOG(LogVMEditor, Log, TEXT("Redo performed (undo stack: %d, redo stack: %d)"),
 			UndoStack.Num(), RedoStack.Num());
 	}
 }
@@ -754,7 +765,7 @@ void UVMLayoutDesignerWidget::ClearUndoHistory()
 {
 	UndoStack.Empty();
 	RedoStack.Empty();
-	UE_LOG(LogViewportManager, Log, TEXT("Cleared undo/redo history"));
+	UE_LOG(LogVMEditor, Log, TEXT("Cleared undo/redo history"));
 }
 
 UVMSplitLayoutAsset* UVMLayoutDesignerWidget::DuplicateLayoutAsset(UVMSplitLayoutAsset* Source)
@@ -0,0 +1,108 @@
+// Copyright jackcayc924 2025. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "VMLayoutTemplates.h"
+#include "VMPaneResolution.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace VMLayoutTemplateTests
+{
+	static const FIntPoint TestViewportSize(1920, 1080);
+	static constexpr float TestPixelBudgetMegapixels = 1.0f;
+	static constexpr float TestFixedScale = 0.5f;
+	static constexpr float Tolerance = 1.0e-3f;
+
+	/**
+	 * Expected scales per template at 1920x1080 with a 1 MP budget and the default 0.25 minimum,
+	 * worked out by hand from the template rects. Templates tile the screen, so the budget
+	 * scale is sqrt(1e6 / 2073600) = 0.6944, except picture-in-picture whose inset adds 1/16.
+	 */
+	struct FExpectedTemplateScales
+	{
+		const TCHAR* Name;
+		TArray<float> AreaProportional;
+		TArray<float> PixelBudget;
+	};
+
+	static TArray<FExpectedTemplateScales> GetExpectedScales()
+	{
+		return {
+			{ TEXT("Single Fullscreen"), { 1.0f }, { 0.6944f } },
+			{ TEXT("Two Player - Horizontal Split"), { 1.0f, 1.0f }, { 0.6944f, 0.6944f } },
+			{ TEXT("Two Player - Vertical Split"), { 1.0f, 1.0f }, { 0.6944f, 0.6944f } },
+			{ TEXT("Four Player - Grid"), { 1.0f, 1.0f, 1.0f, 1.0f }, { 0.6944f, 0.6944f, 0.6944f, 0.6944f } },
+			// The 1/16 inset lands exactly on the 0.25 minimum
+			{ TEXT("Picture-in-Picture"), { 1.0f, 0.25f }, { 0.6737f, 0.6737f } },
+			{ TEXT("Three Player - Asymmetric"), { 1.0f, 0.4996f, 0.4996f }, { 0.6944f, 0.6944f, 0.6944f } },
+			// The middle column is 0.334 wide, so the outer columns are just below native
+			{ TEXT("Six Player - Grid"), { 0.9985f, 1.0f, 0.9985f, 0.9985f, 1.0f, 0.9985f }, { 0.6944f, 0.6944f, 0.6944f, 0.6944f, 0.6944f, 0.6944f } },
+		};
+	}
+
+	static TArray<float> ComputeTemplateScales(const FVMLayoutTemplate& Template, EVMPaneResolutionPolicy Policy)
+	{
+		TArray<FVMSplitPane> Panes = Template.Panes;
+		for (FVMSplitPane& Pane : Panes)
+		{
+			Pane.bUIOnly = false;
+			Pane.ResolutionPolicy = Policy;
+			Pane.ResolutionScale = TestFixedScale;
+		}
+
+		TArray<float> Scales;
+		FVMPaneResolution::ComputeScales(Panes, TestViewportSize, TestPixelBudgetMegapixels, Scales);
+		return Scales;
+	}
+
+	static void TestScales(FAutomationTestBase& Test, const FString& What, const TArray<float>& Actual, const TArray<float>& Expected)
+	{
+		if (!Test.TestEqual(What + TEXT(" pane count"), Actual.Num(), Expected.Num()))
+		{
+			return;
+		}
+
+		for (int32 i = 0; i < Expected.Num(); ++i)
+		{
+			Test.TestEqual(FString::Printf(TEXT("%s pane %d"), *What, i), Actual[i], Expected[i], Tolerance);
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVMLayoutTemplateResolutionScalesTest, "ViewportManager.Editor.LayoutTemplates.ResolutionScales",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FVMLayoutTemplateResolutionScalesTest::RunTest(const FString& Parameters)
+{
+	using namespace VMLayoutTemplateTests;
+
+	const TArray<FVMLayoutTemplate> Templates = FVMLayoutTemplateLibrary::GetAllTemplates();
+	const TArray<FExpectedTemplateScales> ExpectedScales = GetExpectedScales();
+	if (!TestEqual(TEXT("Every template has expected scales"), Templates.Num(), ExpectedScales.Num()))
+	{
+		return false;
+	}
+
+	for (int32 TemplateIndex = 0; TemplateIndex < Templates.Num(); ++TemplateIndex)
+	{
+		const FVMLayoutTemplate& Template = Templates[TemplateIndex];
+		const FExpectedTemplateScales& Expected = ExpectedScales[TemplateIndex];
+		const FString Name = Template.Name.ToString();
+		TestEqual(TEXT("Template order"), Name, FString(Expected.Name));
+
+		TArray<float> NativeScales;
+		TArray<float> FixedScales;
+		NativeScales.Init(1.0f, Template.Panes.Num());
+		FixedScales.Init(TestFixedScale, Template.Panes.Num());
+
+		TestScales(*this, Name + TEXT(" / Native"), ComputeTemplateScales(Template, EVMPaneResolutionPolicy::Native), NativeScales);
+		TestScales(*this, Name + TEXT(" / FixedScale"), ComputeTemplateScales(Template, EVMPaneResolutionPolicy::FixedScale), FixedScales);
+		TestScales(*this, Name + TEXT(" / AreaProportional"), ComputeTemplateScales(Template, EVMPaneResolutionPolicy::AreaProportional), Expected.AreaProportional);
+		TestScales(*this, Name + TEXT(" / PixelBudget"), ComputeTemplateScales(Template, EVMPaneResolutionPolicy::PixelBudget), Expected.PixelBudget);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS